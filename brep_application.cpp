@@ -10,6 +10,7 @@
 
 
 // System includes
+#include <string>
 
 
 // External includes
@@ -17,6 +18,56 @@
 
 // Project includes
 #include "brep_application.h"
+#include "includes/serializer.h"
+#include "custom_algebra/function/function.h"
+#include "custom_algebra/function/heaviside_function.h"
+#include "custom_algebra/function/cached_heaviside_function.h"
+#include "custom_algebra/function/scalar_function.h"
+#include "custom_algebra/function/zero_function.h"
+#include "custom_algebra/function/monomial_function.h"
+#include "custom_algebra/function/trigonometric_function.h"
+#include "custom_algebra/function/product_function.h"
+#include "custom_algebra/function/sum_function.h"
+#include "custom_algebra/function/scale_function.h"
+#include "custom_algebra/function/pow_function.h"
+#include "custom_algebra/function/negate_function.h"
+#include "custom_algebra/function/inverse_function.h"
+#include "custom_algebra/function/cubic_spline_function.h"
+#include "custom_algebra/function/compiled_function.h"
+#include "custom_algebra/function/polynomial_function.h"
+#include "custom_algebra/function/tabulated_function.h"
+#ifdef BREP_APPLICATION_USE_MASHPRESSO
+#include "custom_algebra/function/mathpresso_function.h"
+#endif
+#include "custom_algebra/function/load_function.h"
+#include "custom_algebra/function/load_function_plate_with_the_hole.h"
+#include "custom_algebra/function/hydrostatic_pressure_function_on_surface.h"
+#include "custom_algebra/brep.h"
+#include "custom_algebra/and_brep.h"
+#include "custom_algebra/not_brep.h"
+#include "custom_algebra/natm_arc_brep.h"
+#include "custom_algebra/level_set/level_set.h"
+#include "custom_algebra/level_set/circular_level_set.h"
+#include "custom_algebra/level_set/doughnut_level_set.h"
+#include "custom_algebra/level_set/spherical_level_set.h"
+#include "custom_algebra/level_set/cylinder_level_set.h"
+#include "custom_algebra/level_set/cone_level_set.h"
+#include "custom_algebra/level_set/linear_level_set.h"
+#include "custom_algebra/level_set/planar_level_set.h"
+#include "custom_algebra/level_set/product_level_set.h"
+#include "custom_algebra/level_set/inverse_level_set.h"
+#include "custom_algebra/level_set/union_level_set.h"
+#include "custom_algebra/level_set/intersection_level_set.h"
+#include "custom_algebra/level_set/difference_level_set.h"
+#include "custom_algebra/level_set/distance_to_curve_level_set.h"
+#include "custom_algebra/level_set/grid_level_set.h"
+#include "custom_algebra/level_set/triangle_mesh_level_set.h"
+#include "custom_algebra/level_set/nary_union_level_set.h"
+#include "custom_algebra/level_set/nary_intersection_level_set.h"
+#include "custom_algebra/curve/curve.h"
+#include "custom_algebra/curve/parametric_curve.h"
+#include "custom_algebra/surface/parametric_surface.h"
+#include "custom_algebra/volume/parametric_volume.h"
 // #include "geometries/triangle_2d_3.h"
 
 
@@ -31,6 +82,40 @@ namespace Kratos
     KRATOS_CREATE_VARIABLE( double, CURVE_UPPER_BOUND )
     KRATOS_CREATE_VARIABLE( int, CURVE_NUMBER_OF_SAMPLING )
 
+    /// Name of a monomial as in python, e.g. X2Y for x^2*y
+    std::string MonomialName(const std::size_t& DegreeX, const std::size_t& DegreeY, const std::size_t& DegreeZ)
+    {
+        const std::size_t Degrees[] = {DegreeX, DegreeY, DegreeZ};
+        const char* Variables[] = {"X", "Y", "Z"};
+        std::stringstream ss;
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            if (Degrees[i] > 0)
+                ss << Variables[i];
+            if (Degrees[i] > 1)
+                ss << Degrees[i];
+        }
+        return ss.str();
+    }
+
+    /// Register the monomials x^i*y^j*z^k, 0 <= i, j, k <= 6 in the serializer, except the constant one
+    template<std::size_t TIndex>
+    struct MonomialFunctionR3R1Registry
+    {
+        static void Register()
+        {
+            Serializer::Register("MonomialFunctionR3R1" + MonomialName(TIndex / 49, (TIndex / 7) % 7, TIndex % 7),
+                    MonomialFunctionR3R1<TIndex / 49, (TIndex / 7) % 7, TIndex % 7>());
+            MonomialFunctionR3R1Registry<TIndex - 1>::Register();
+        }
+    };
+
+    template<>
+    struct MonomialFunctionR3R1Registry<0>
+    {
+        static void Register() {}
+    };
+
     KratosBRepApplication::KratosBRepApplication()
     : KratosApplication()
     {}
@@ -49,6 +134,97 @@ namespace Kratos
         KRATOS_REGISTER_VARIABLE( CURVE_LOWER_BOUND )
         KRATOS_REGISTER_VARIABLE( CURVE_UPPER_BOUND )
         KRATOS_REGISTER_VARIABLE( CURVE_NUMBER_OF_SAMPLING )
+
+        // register the functions, curves, level sets and breps in the serializer, with their names in python
+        Serializer::Register("ZeroFunctionR1R1", ZeroFunction<FunctionR1R1>());
+        Serializer::Register("ScalarFunctionR1R1", ScalarFunction<FunctionR1R1>());
+        Serializer::Register("ScaleFunctionR1R1", ScaleFunction<FunctionR1R1>());
+        Serializer::Register("SumFunctionR1R1", SumFunction<FunctionR1R1>());
+        Serializer::Register("ProductFunctionR1R1", ProductFunction<FunctionR1R1>());
+        Serializer::Register("PowFunctionR1R1", PowFunction<FunctionR1R1>());
+        Serializer::Register("NegateFunctionR1R1", NegateFunction<FunctionR1R1>());
+        Serializer::Register("InverseFunctionR1R1", InverseFunction<FunctionR1R1>());
+        Serializer::Register("SinFunctionR1R1", SinFunction<FunctionR1R1>());
+        Serializer::Register("CosFunctionR1R1", CosFunction<FunctionR1R1>());
+        Serializer::Register("AcosFunctionR1R1", AcosFunction<FunctionR1R1>());
+        Serializer::Register("PolynomialFunctionR1R1", PolynomialFunction<FunctionR1R1>());
+        Serializer::Register("CompiledFunctionR1R1", CompiledFunction<FunctionR1R1>());
+        Serializer::Register("TabulatedFunctionR1R1", TabulatedFunction<FunctionR1R1>());
+        Serializer::Register("CubicSplineFunctionR1R1", CubicSplineFunction<0>());
+        Serializer::Register("DerivativeCubicSplineFunctionR1R1", CubicSplineFunction<1>());
+        Serializer::Register("SecondDerivativeCubicSplineFunctionR1R1", CubicSplineFunction<2>());
+        Serializer::Register("ThirdDerivativeCubicSplineFunctionR1R1", CubicSplineFunction<3>());
+        Serializer::Register("MonomialFunctionR1R1X", MonomialFunctionR1R1<1>());
+        Serializer::Register("MonomialFunctionR1R1X2", MonomialFunctionR1R1<2>());
+        Serializer::Register("MonomialFunctionR1R1X3", MonomialFunctionR1R1<3>());
+        Serializer::Register("MonomialFunctionR1R1X4", MonomialFunctionR1R1<4>());
+        Serializer::Register("MonomialFunctionR1R1X5", MonomialFunctionR1R1<5>());
+
+        Serializer::Register("TabulatedFunctionR1R3", TabulatedFunction<FunctionR1R3>());
+
+        Serializer::Register("ScaleFunctionR2R1", ScaleFunction<FunctionR2R1>());
+        Serializer::Register("SumFunctionR2R1", SumFunction<FunctionR2R1>());
+        Serializer::Register("ProductFunctionR2R1", ProductFunction<FunctionR2R1>());
+        Serializer::Register("SinFunctionR2R1", SinFunction<FunctionR2R1>());
+        Serializer::Register("CosFunctionR2R1", CosFunction<FunctionR2R1>());
+        Serializer::Register("AcosFunctionR2R1", AcosFunction<FunctionR2R1>());
+        Serializer::Register("PolynomialFunctionR2R1", PolynomialFunction<FunctionR2R1>());
+        Serializer::Register("CompiledFunctionR2R1", CompiledFunction<FunctionR2R1>());
+        Serializer::Register("MonomialFunctionR2R1X", MonomialFunctionR2R1<1, 0>());
+        Serializer::Register("MonomialFunctionR2R1Y", MonomialFunctionR2R1<0, 1>());
+
+        Serializer::Register("ZeroFunctionR3R1", ZeroFunction<FunctionR3R1>());
+        Serializer::Register("ScalarFunctionR3R1", ScalarFunction<FunctionR3R1>());
+        Serializer::Register("ScaleFunctionR3R1", ScaleFunction<FunctionR3R1>());
+        Serializer::Register("SumFunctionR3R1", SumFunction<FunctionR3R1>());
+        Serializer::Register("ProductFunctionR3R1", ProductFunction<FunctionR3R1>());
+        Serializer::Register("PowFunctionR3R1", PowFunction<FunctionR3R1>());
+        Serializer::Register("NegateFunctionR3R1", NegateFunction<FunctionR3R1>());
+        Serializer::Register("InverseFunctionR3R1", InverseFunction<FunctionR3R1>());
+        Serializer::Register("SinFunctionR3R1", SinFunction<FunctionR3R1>());
+        Serializer::Register("CosFunctionR3R1", CosFunction<FunctionR3R1>());
+        Serializer::Register("AcosFunctionR3R1", AcosFunction<FunctionR3R1>());
+        Serializer::Register("PolynomialFunctionR3R1", PolynomialFunction<FunctionR3R1>());
+        Serializer::Register("CompiledFunctionR3R1", CompiledFunction<FunctionR3R1>());
+        Serializer::Register("HeavisideFunctionR3R1", HeavisideFunction<FunctionR3R1>());
+        Serializer::Register("CachedHeavisideFunctionR3R1", CachedHeavisideFunction<FunctionR3R1>());
+        #ifdef BREP_APPLICATION_USE_MASHPRESSO
+        Serializer::Register("MathPressoFunctionR3R1", MathPressoFunctionR3R1());
+        #endif
+        MonomialFunctionR3R1Registry<342>::Register();
+
+        Serializer::Register("ScaleFunctionR3R3", ScaleFunction<FunctionR3R3>());
+        Serializer::Register("LoadFunctionR3R3", LoadFunctionR3RN<3>());
+        Serializer::Register("HydrostaticPressureFunctionOnSurface", HydrostaticPressureFunctionOnSurface());
+        Serializer::Register("LoadFunctionR3Rn", LoadFunctionR3Rn());
+        Serializer::Register("LoadFunctionR3RnPlateWithTheHoleX", LoadFunctionR3RnPlateWithTheHole<0>());
+        Serializer::Register("LoadFunctionR3RnPlateWithTheHoleY", LoadFunctionR3RnPlateWithTheHole<1>());
+
+        Serializer::Register("ParametricCurve", ParametricCurve());
+        Serializer::Register("ParametricSurface", ParametricSurface());
+        Serializer::Register("ParametricVolume", ParametricVolume());
+
+        Serializer::Register("CircularLevelSet", CircularLevelSet());
+        Serializer::Register("DoughnutLevelSet", DoughnutLevelSet());
+        Serializer::Register("SphericalLevelSet", SphericalLevelSet());
+        Serializer::Register("CylinderLevelSet", CylinderLevelSet());
+        Serializer::Register("ConeLevelSet", ConeLevelSet());
+        Serializer::Register("LinearLevelSet", LinearLevelSet());
+        Serializer::Register("PlanarLevelSet", PlanarLevelSet());
+        Serializer::Register("ProductLevelSet", ProductLevelSet());
+        Serializer::Register("InverseLevelSet", InverseLevelSet());
+        Serializer::Register("UnionLevelSet", UnionLevelSet());
+        Serializer::Register("IntersectionLevelSet", IntersectionLevelSet());
+        Serializer::Register("DifferenceLevelSet", DifferenceLevelSet());
+        Serializer::Register("DistanceToCurveLevelSet", DistanceToCurveLevelSet());
+        Serializer::Register("GridLevelSet", GridLevelSet());
+        Serializer::Register("TriangleMeshLevelSet", TriangleMeshLevelSet());
+        Serializer::Register("NaryUnionLevelSet", NaryUnionLevelSet());
+        Serializer::Register("NaryIntersectionLevelSet", NaryIntersectionLevelSet());
+
+        Serializer::Register("AndBRep", AndBRep());
+        Serializer::Register("NotBRep", NotBRep());
+        Serializer::Register("NATMArcBRep", NATMArcBRep());
     }
 
 } // namespace Kratos
@@ -30,6 +30,8 @@
 #include "includes/element.h"
 #include "includes/ublas_interface.h"
 #include "geometries/geometry_data.h"
+#include "custom_algebra/brep.h"
+#include "custom_algebra/level_set/level_set.h"
 
 
 namespace Kratos
@@ -85,6 +87,10 @@ public:
     : mpBRep1(pBRep1), mpBRep2(pBRep2), BaseType()
     {}
 
+    /// Default constructor, only used by the serializer.
+    AndBRep() : BaseType()
+    {}
+
     /// Copy constructor.
     AndBRep(AndBRep const& rOther)
     : BaseType(rOther)
@@ -131,6 +137,47 @@ public:
         return (mpBRep1->IsInside(P) && mpBRep2->IsInside(P));
     }
 
+    /// The intersection of the bounding boxes, or the bounding box of the bounded BRep
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        PointType Min2, Max2;
+        const bool is_bounded_1 = mpBRep1->GetBoundingBox(rMin, rMax);
+        const bool is_bounded_2 = mpBRep2->GetBoundingBox(Min2, Max2);
+
+        if(!is_bounded_2)
+            return is_bounded_1;
+
+        if(!is_bounded_1)
+        {
+            noalias(rMin) = Min2;
+            noalias(rMax) = Max2;
+            return true;
+        }
+
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            rMin[d] = std::max(rMin[d], Min2[d]);
+            rMax[d] = std::min(rMax[d], Max2[d]);
+        }
+        return true;
+    }
+
+    virtual int CutStatusOfBox(const PointType& rMin, const PointType& rMax) const
+    {
+        const int stat_1 = mpBRep1->CutStatusOfBox(rMin, rMax);
+        if(stat_1 == _OUT)
+            return _OUT;
+
+        const int stat_2 = mpBRep2->CutStatusOfBox(rMin, rMax);
+        if(stat_2 == _OUT)
+            return _OUT;
+
+        if(stat_1 == _IN && stat_2 == _IN)
+            return _IN;
+
+        return _CUT;
+    }
+
     /// Check if a geometry is cut by the level set
     /// 0: the cell is completely inside the domain bounded by level set
     /// 1: completely outside
@@ -265,6 +312,10 @@ private:
     BRep::Pointer mpBRep1;
     BRep::Pointer mpBRep2;
 
+    /// The operands which are level sets, as loaded by the serializer
+    LevelSet::Pointer mpLevelSet1;
+    LevelSet::Pointer mpLevelSet2;
+
     ///@}
     ///@name Private Operators
     ///@{
@@ -274,6 +325,21 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        LevelSet::SaveBRep(rSerializer, "BRep1", mpBRep1);
+        LevelSet::SaveBRep(rSerializer, "BRep2", mpBRep2);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        LevelSet::LoadBRep(rSerializer, "BRep1", mpBRep1, mpLevelSet1);
+        LevelSet::LoadBRep(rSerializer, "BRep2", mpBRep2, mpLevelSet2);
+    }
 
     ///@}
     ///@name Private  Access
@@ -26,6 +26,26 @@ BRep::BRep() : mTOL(1.0e-10)
 BRep::~BRep()
 {}
 
+int BRep::CutStatusOfBox(const PointType& rMin, const PointType& rMax) const
+{
+    PointType BoxMin, BoxMax;
+    if (!this->GetBoundingBox(BoxMin, BoxMax))
+        return _CUT;
+
+    for (std::size_t d = 0; d < 3; ++d)
+    {
+        if (rMax[d] < BoxMin[d] - mTOL || rMin[d] > BoxMax[d] + mTOL)
+            return _OUT;
+    }
+
+    return _CUT;
+}
+
+int BRep::CutStatusOfBoxByBounds(const PointType& rMin, const PointType& rMax) const
+{
+    return this->CutStatusOfBox(rMin, rMax);
+}
+
 int BRep::CutStatus(Element::Pointer p_elem, const int& configuration) const
 {
     return this->CutStatus(p_elem->GetGeometry(), configuration);
@@ -38,15 +58,22 @@ int BRep::CutStatus(GeometryType::Pointer p_geom, const int& configuration) cons
 
 int BRep::CutStatus(GeometryType& r_geom, const int& configuration) const
 {
+    int stat;
     if (configuration == 0)
     {
         std::vector<PointType> points(r_geom.size());
         for (std::size_t i = 0; i < r_geom.size(); ++i)
             noalias(points[i]) = r_geom[i].GetInitialPosition();
+        stat = CutStatusOfBoundingBox(points);
+        if (stat != _CUT)
+            return stat;
         return CutStatusOfPoints(points);
     }
     else if (configuration == 1)
     {
+        stat = CutStatusOfBoundingBox(r_geom);
+        if (stat != _CUT)
+            return stat;
         return CutStatusOfPoints(r_geom);
         // REMARK: this will use the current position of node, e.g. in dynamics
     }
@@ -54,6 +81,9 @@ int BRep::CutStatus(GeometryType& r_geom, const int& configuration) const
 
 int BRep::CutStatus(const std::vector<PointType>& r_points) const
 {
+    const int stat = CutStatusOfBoundingBox(r_points);
+    if (stat != _CUT)
+        return stat;
     return CutStatusOfPoints(r_points);
 }
 
@@ -69,13 +99,33 @@ int BRep::CutStatusBySampling(GeometryType::Pointer p_geom, const std::size_t& n
 
 int BRep::CutStatusBySampling(GeometryType& r_geom, const std::size_t& nsampling, const int& configuration) const
 {
+    if (configuration != 0 && configuration != 1)
+        KRATOS_THROW_ERROR(std::logic_error, "Unknown configuration", configuration)
+
+    // the box of the nodes is classified first, the sampling points are only generated if it can't be decided
+    if (r_geom.size() != 0)
+    {
+        std::vector<PointType> points(r_geom.size());
+        for (std::size_t i = 0; i < r_geom.size(); ++i)
+        {
+            if (configuration == 0)
+                noalias(points[i]) = r_geom[i].GetInitialPosition();
+            else
+                noalias(points[i]) = r_geom[i].Coordinates();
+        }
+
+        PointType Min, Max;
+        ComputeBoundingBox(points, Min, Max);
+        const int stat = this->CutStatusOfBoxByBounds(Min, Max);
+        if (stat != _CUT)
+            return stat;
+    }
+
     std::vector<PointType> SamplingPoints;
     if (configuration == 0)
         BRepMeshUtility::GenerateSamplingPoints<0>(SamplingPoints, r_geom, nsampling);
-    else if (configuration == 1)
-        BRepMeshUtility::GenerateSamplingPoints<1>(SamplingPoints, r_geom, nsampling);
     else
-        KRATOS_THROW_ERROR(std::logic_error, "Unknown configuration", configuration)
+        BRepMeshUtility::GenerateSamplingPoints<1>(SamplingPoints, r_geom, nsampling);
     return this->CutStatus(SamplingPoints);
 }
 
@@ -19,6 +19,7 @@
 
 // System includes
 #include <string>
+#include <limits>
 #include <iostream>
 
 
@@ -29,6 +30,7 @@
 #include "includes/define.h"
 #include "includes/element.h"
 #include "includes/ublas_interface.h"
+#include "includes/serializer.h"
 #include "geometries/geometry_data.h"
 
 
@@ -139,6 +141,26 @@ public:
         KRATOS_THROW_ERROR(std::logic_error, "Calling the base class", __FUNCTION__)
     }
 
+    /// Get the axis-aligned bounding box of the domain bounded by the BRep, i.e. the points inside of the BRep lie
+    /// within [rMin, rMax]. The extent is infinite in the directions where the domain is unbounded.
+    /// Return false if the BRep does not provide its bounding box.
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        return false;
+    }
+
+    /// Check if an axis-aligned box is cut by the BRep, without evaluating any point
+    /// 0: the box is completely inside the domain bounded by BRep
+    /// 1: completely outside
+    /// -1: the box may be cut by BRep, i.e. it can't be decided without evaluating the points
+    /// By default, the box is outside if it is disjoint from the bounding box of the BRep.
+    virtual int CutStatusOfBox(const PointType& rMin, const PointType& rMax) const;
+
+    /// Check if an axis-aligned box is cut by the BRep using the bounds of the BRep only, without sampling the box.
+    /// 0 or 1 is only returned if the box is proven to be completely inside or outside; -1 if it can't be decided.
+    /// By default, this is CutStatusOfBox. The level sets also use their Lipschitz bound.
+    virtual int CutStatusOfBoxByBounds(const PointType& rMin, const PointType& rMax) const;
+
     /// Check if an element is cut by the brep
     int CutStatus(Element::Pointer p_elem, const int& configuration) const;
 
@@ -216,6 +238,35 @@ public:
     ///@name Inquiry
     ///@{
 
+    /// Compute the bounding box of a non-empty set of points
+    template<class TPointsContainerType>
+    static void ComputeBoundingBox(const TPointsContainerType& r_points, PointType& rMin, PointType& rMax)
+    {
+        for(std::size_t d = 0; d < 3; ++d)
+            rMin[d] = rMax[d] = r_points[0][d];
+
+        for(std::size_t v = 1; v < r_points.size(); ++v)
+        {
+            for(std::size_t d = 0; d < 3; ++d)
+            {
+                rMin[d] = std::min(rMin[d], r_points[v][d]);
+                rMax[d] = std::max(rMax[d], r_points[v][d]);
+            }
+        }
+    }
+
+    /// Check if a set of points is cut by the BRep using only the bounding box of the points, see CutStatusOfBox
+    template<class TPointsContainerType>
+    int CutStatusOfBoundingBox(const TPointsContainerType& r_points) const
+    {
+        if(r_points.size() == 0)
+            return BRep::_CUT;
+
+        PointType Min, Max;
+        ComputeBoundingBox(r_points, Min, Max);
+        return this->CutStatusOfBox(Min, Max);
+    }
+
     template<class TPointsContainerType>
     int CutStatusOfPoints(const TPointsContainerType& r_points) const
     {
@@ -347,6 +398,17 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        rSerializer.save("TOL", mTOL);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        rSerializer.load("TOL", mTOL);
+    }
 
     ///@}
     ///@name Private  Access
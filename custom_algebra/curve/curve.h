@@ -79,6 +79,17 @@ public:
 
     typedef BaseType::OutputType OutputType;
 
+    /// The parameters of the search for the projection on the curve. They are read from the data value container when
+    /// the curve is set up and passed down to the search, so that the queries do not access the container.
+    struct SearchSettings
+    {
+        double LowerBound;
+        double UpperBound;
+        int NumberOfSampling;
+        double Tolerance;
+        int MaxIterations;
+    };
+
     ///@}
     ///@name Life Cycle
     ///@{
@@ -88,10 +99,11 @@ public:
     {
         DataValueContainer::SetValue(CURVE_SEARCH_TOLERANCE, 1.0e-10);
         DataValueContainer::SetValue(CURVE_MAX_ITERATIONS, 300);
+        this->Initialize();
     }
 
     /// Copy constructor.
-    Curve(Curve const& rOther) : BaseType(rOther), DataValueContainer(rOther)
+    Curve(Curve const& rOther) : BaseType(rOther), DataValueContainer(rOther), mSearchSettings(rOther.mSearchSettings)
     {}
 
     /// Destructor.
@@ -155,10 +167,7 @@ public:
     /// On output, the distance and local coordinates of the projection point are returned
     double ComputeDistance(const PointType& P, double& t) const
     {
-        double tmin = DataValueContainer::GetValue(CURVE_LOWER_BOUND);
-        double tmax = DataValueContainer::GetValue(CURVE_UPPER_BOUND);
-        double nsampling = DataValueContainer::GetValue(CURVE_NUMBER_OF_SAMPLING);
-        double d = ComputeDistanceByBisection(P, t, tmin, tmax, nsampling);
+        double d = ComputeDistanceByBisection(P, t, mSearchSettings);
         return d;
     }
 
@@ -174,10 +183,7 @@ public:
     /// Because the bisection algorithm is used, user must notice some additional parameters may be necessary to give successful return
     int ProjectOnCurve(const PointType& P, PointType& Proj, double& t) const
     {
-        double tmin = DataValueContainer::GetValue(CURVE_LOWER_BOUND);
-        double tmax = DataValueContainer::GetValue(CURVE_UPPER_BOUND);
-        double nsampling = DataValueContainer::GetValue(CURVE_NUMBER_OF_SAMPLING);
-        return this->ProjectOnCurveUsingBisection(P, Proj, t, tmin, tmax, nsampling);
+        return this->ProjectOnCurveUsingBisection(P, Proj, t, mSearchSettings);
     }
 
     /// Compute the projection on the the curve
@@ -203,6 +209,45 @@ public:
     ///@name Access
     ///@{
 
+    /// Read the parameters of the projection from the data value container. This is called by the constructors, after
+    /// load and by SetValue; it must be called again if the container is modified directly.
+    void Initialize()
+    {
+        mSearchSettings.LowerBound = DataValueContainer::GetValue(CURVE_LOWER_BOUND);
+        mSearchSettings.UpperBound = DataValueContainer::GetValue(CURVE_UPPER_BOUND);
+        mSearchSettings.NumberOfSampling = DataValueContainer::GetValue(CURVE_NUMBER_OF_SAMPLING);
+        mSearchSettings.Tolerance = DataValueContainer::GetValue(CURVE_SEARCH_TOLERANCE);
+        mSearchSettings.MaxIterations = DataValueContainer::GetValue(CURVE_MAX_ITERATIONS);
+    }
+
+
+    /// Set the parameters of the projection, in the data value container as well
+    void SetSearchSettings(const SearchSettings& rSettings)
+    {
+        DataValueContainer::SetValue(CURVE_LOWER_BOUND, rSettings.LowerBound);
+        DataValueContainer::SetValue(CURVE_UPPER_BOUND, rSettings.UpperBound);
+        DataValueContainer::SetValue(CURVE_NUMBER_OF_SAMPLING, rSettings.NumberOfSampling);
+        DataValueContainer::SetValue(CURVE_SEARCH_TOLERANCE, rSettings.Tolerance);
+        DataValueContainer::SetValue(CURVE_MAX_ITERATIONS, rSettings.MaxIterations);
+        mSearchSettings = rSettings;
+    }
+
+
+    /// Get the parameters of the projection
+    const SearchSettings& GetSearchSettings() const
+    {
+        return mSearchSettings;
+    }
+
+
+    /// Set a value in the data value container and read the parameters of the projection again
+    template<class TVariableType>
+    void SetValue(const TVariableType& rThisVariable, const typename TVariableType::Type& rValue)
+    {
+        DataValueContainer::SetValue(rThisVariable, rValue);
+        this->Initialize();
+    }
+
 
     ///@}
     ///@name Inquiry
@@ -285,6 +330,9 @@ private:
     ///@{
 
 
+    SearchSettings mSearchSettings;
+
+
     ///@}
     ///@name Private Operators
     ///@{
@@ -294,12 +342,27 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, DataValueContainer)
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, DataValueContainer)
+        this->Initialize();
+    }
+
     /// Compute the distance based on Newton Raphson, quick but unstable
     /// On output, the distance and local coordinates of the projection point are returned
-    double ComputeDistanceByNewtonRaphson(const PointType& P, double& t) const
+    double ComputeDistanceByNewtonRaphson(const PointType& P, double& t, const SearchSettings& rSettings) const
     {
-        const double tol = DataValueContainer::GetValue(CURVE_SEARCH_TOLERANCE);
-        const int max_iters = DataValueContainer::GetValue(CURVE_MAX_ITERATIONS);
+        const double tol = rSettings.Tolerance;
+        const int max_iters = rSettings.MaxIterations;
 
         // firstly compute the projection of point P to the curve
         int iter = 0;
@@ -340,10 +403,14 @@ private:
     /// Compute the distance based on bisection algorithm, slow but stable
     /// On return, the distance and local coordinates of the projection point are returned
     /// This subroutine require a bound to search for the local projection point. A sampling is required so that at least one segment exists by which the projection function <dP, P'-P> has reversed sign
-    double ComputeDistanceByBisection(const PointType& P, double& t, const double& tmin, const double& tmax, const int& nsampling) const
+    double ComputeDistanceByBisection(const PointType& P, double& t, const SearchSettings& rSettings) const
     {
+        const double tmin = rSettings.LowerBound;
+        const double tmax = rSettings.UpperBound;
+        const int nsampling = rSettings.NumberOfSampling;
+
         PointType Proj;
-        int stat = ProjectOnCurveUsingBisection(P, Proj, t, tmin, tmax, nsampling);
+        int stat = ProjectOnCurveUsingBisection(P, Proj, t, rSettings);
 
         // if the bisection can't find the point in [tmin, tmax] region. The projection point will be computed before tmin or after tmax using the tangent information on that point.
         if (stat != 0)
@@ -406,14 +473,21 @@ private:
     ///     + 0: projection point is found inside the parametric domain of the curve
     ///     + 1: the point does not have projection inside parametric domain and is on the left side
     ///     + 2: the point does not have projection inside parametric domain and is on the right side
-    int ProjectOnCurveUsingBisection(const PointType& P, PointType& Proj, double& t, const double& tmin, const double& tmax, const int& nsampling) const
+    /// The sampling values are local to the call, hence the projection can be called concurrently.
+    int ProjectOnCurveUsingBisection(const PointType& P, PointType& Proj, double& t, const SearchSettings& rSettings) const
     {
-        const double tol = DataValueContainer::GetValue(CURVE_SEARCH_TOLERANCE);
+        const double tmin = rSettings.LowerBound;
+        const double tmax = rSettings.UpperBound;
+        const int nsampling = rSettings.NumberOfSampling;
+        const double tol = rSettings.Tolerance;
+
+        if (nsampling < 1)
+            KRATOS_THROW_ERROR(std::logic_error, "The number of sampling of the curve must be positive, current value is", nsampling)
 
-        // firstly do the sampling
-        std::vector<double> f(nsampling);
+        // firstly do the sampling, at the nsampling+1 end points of the segments
+        std::vector<double> f(nsampling+1);
         PointType dProj;
-        for (std::size_t i = 0; i < nsampling+1; ++i)
+        for (int i = 0; i < nsampling+1; ++i)
         {
             t = tmin + i*(tmax-tmin)/nsampling;
             noalias(Proj) = this->GetValue(t);
@@ -422,7 +496,7 @@ private:
         }
 
         int stat = -1;
-        for (std::size_t i = 0; i < nsampling; ++i)
+        for (int i = 0; i < nsampling; ++i)
         {
             if (fabs(f[i]) < tol)
             {
@@ -437,7 +511,7 @@ private:
                 // found the segment, do the bisection
                 double left = tmin + i*(tmax-tmin)/nsampling;
                 double right = tmin + (i+1)*(tmax-tmin)/nsampling;
-                double mid;
+                double mid = 0.5*(left + right);
                 double fleft = f[i], fright = f[i+1], fmid;
                 while ((right - left) > tol)
                 {
@@ -481,7 +555,7 @@ private:
                 noalias(Proj) = this->GetValue(t);
                 stat = 1;
             }
-            if (f[nsampling-1] > tol)
+            if (f[nsampling] > tol)
             {
                 t = tmax; // set default value to t
                 noalias(Proj) = this->GetValue(t);
@@ -19,6 +19,7 @@
 
 // System includes
 #include <string>
+#include <vector>
 #include <iostream>
 #include <iomanip>
 
@@ -85,10 +86,15 @@ public:
     : BaseType(), mp_func_x(p_func_x), mp_func_y(p_func_y), mp_func_z(p_func_z)
     {
         DataValueContainer::SetValue(CURVE_LOWER_BOUND, -1.0);
-        DataValueContainer::SetValue(CURVE_LOWER_BOUND, 2.0);
+        DataValueContainer::SetValue(CURVE_UPPER_BOUND, 2.0);
         DataValueContainer::SetValue(CURVE_NUMBER_OF_SAMPLING, 10);
+        this->Initialize();
     }
 
+    /// Default constructor, only used by the serializer.
+    ParametricCurve() : BaseType()
+    {}
+
     /// Copy constructor.
     ParametricCurve(ParametricCurve const& rOther)
     : BaseType(rOther)
@@ -137,6 +143,38 @@ public:
     }
 
 
+    /// inherit from Function
+    virtual void GetValues(const InputType* t, const std::size_t n, OutputType* Values) const
+    {
+        this->GetValuesAndDerivatives(t, n, Values, NULL, NULL);
+    }
+
+
+    /// inherit from Function
+    /// Each component is evaluated over the whole batch, so that the components can sweep the sorted parameters.
+    virtual void GetValuesAndDerivatives(const InputType* t, const std::size_t n, OutputType* Values,
+            OutputType* Derivatives, OutputType* SecondDerivatives) const
+    {
+        std::vector<double> D0((Values != NULL) ? n : 0);
+        std::vector<double> D1((Derivatives != NULL) ? n : 0);
+        std::vector<double> D2((SecondDerivatives != NULL) ? n : 0);
+
+        const FunctionR1R1::Pointer pFuncs[] = {mp_func_x, mp_func_y, mp_func_z};
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            pFuncs[k]->GetValuesAndDerivatives(t, n, (D0.size() != 0) ? &D0[0] : NULL,
+                    (D1.size() != 0) ? &D1[0] : NULL, (D2.size() != 0) ? &D2[0] : NULL);
+
+            for (std::size_t i = 0; i < D0.size(); ++i)
+                Values[i][k] = D0[i];
+            for (std::size_t i = 0; i < D1.size(); ++i)
+                Derivatives[i][k] = D1[i];
+            for (std::size_t i = 0; i < D2.size(); ++i)
+                SecondDerivatives[i][k] = D2[i];
+        }
+    }
+
+
     /// inherit from Function
     virtual OutputType GetDerivative(const int& component, const InputType& t) const
     {
@@ -181,7 +219,13 @@ public:
         std::ofstream fid(filename.c_str());
         fid << std::setprecision(6) << std::scientific;
 
-        OutputType P, DP, D2P;
+        std::vector<double> t(nsampling);
+        for (std::size_t i = 0; i < nsampling; ++i)
+            t[i] = tmin + i*(tmax-tmin)/(nsampling-1);
+
+        std::vector<OutputType> P(nsampling), DP((deriv > 0) ? nsampling : 0), D2P((deriv > 1) ? nsampling : 0);
+        if (nsampling != 0)
+            this->GetValuesAndDerivatives(&t[0], nsampling, &P[0], (deriv > 0) ? &DP[0] : NULL, (deriv > 1) ? &D2P[0] : NULL);
 
         fid << "t\t\t\t\tx\t\t\t\ty\t\t\t\tz";
         if (deriv > 0) fid << "\t\t\t\tdx\t\t\t\tdy\t\t\t\tdz";
@@ -190,21 +234,13 @@ public:
 
         for (std::size_t i = 0; i < nsampling; ++i)
         {
-            double t = tmin + i*(tmax-tmin)/(nsampling-1);
-            P = this->GetValue(t);
-            fid << t << "\t" << P[0] << "\t" << P[1] << "\t" << P[2];
+            fid << t[i] << "\t" << P[i][0] << "\t" << P[i][1] << "\t" << P[i][2];
 
             if (deriv > 0)
-            {
-                DP = this->GetDerivative(0, t);
-                fid << "\t" << DP[0] << "\t" << DP[1] << "\t" << DP[2];
-            }
+                fid << "\t" << DP[i][0] << "\t" << DP[i][1] << "\t" << DP[i][2];
 
             if (deriv > 1)
-            {
-                D2P = this->GetSecondDerivative(0, 0, t);
-                fid << "\t" << D2P[0] << "\t" << D2P[1] << "\t" << D2P[2];
-            }
+                fid << "\t" << D2P[i][0] << "\t" << D2P[i][1] << "\t" << D2P[i][2];
 
             fid << std::endl;
         }
@@ -311,6 +347,23 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("FunctionX", mp_func_x);
+        rSerializer.save("FunctionY", mp_func_y);
+        rSerializer.save("FunctionZ", mp_func_z);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("FunctionX", mp_func_x);
+        rSerializer.load("FunctionY", mp_func_y);
+        rSerializer.load("FunctionZ", mp_func_z);
+    }
 
     ///@}
     ///@name Private  Access
@@ -0,0 +1,539 @@
+//    |  /           |
+//    ' /   __| _` | __|  _ \   __|
+//    . \  |   (   | |   (   |\__ `
+//   _|\_\_|  \__,_|\__|\___/ ____/
+//                   Multi-Physics
+//
+//  License:         brep_application/LICENSE.txt
+//                   Kratos default license: kratos/license.txt
+//
+//  Main authors:    Hoang-Giang Bui
+//  Date:            16 Oct 2026
+//
+
+
+#if !defined(KRATOS_CACHED_HEAVISIDE_FUNCTION_H_INCLUDED )
+#define  KRATOS_CACHED_HEAVISIDE_FUNCTION_H_INCLUDED
+
+
+
+// System includes
+#include <cmath>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <iostream>
+
+
+// External includes
+
+
+// Project includes
+#include "includes/define.h"
+#include "custom_algebra/function/function.h"
+#include "custom_algebra/function/zero_function.h"
+#include "custom_algebra/brep.h"
+#include "custom_algebra/level_set/level_set.h"
+
+
+namespace Kratos
+{
+///@addtogroup BRepApplication
+///@{
+
+///@name Kratos Globals
+///@{
+
+///@}
+///@name Type Definitions
+///@{
+
+///@}
+///@name  Enum's
+///@{
+
+///@}
+///@name  Functions
+///@{
+
+///@}
+///@name Kratos Classes
+///@{
+
+/// Short class definition.
+/** Heaviside function of a BRep with a spatial cache, for the BReps where IsInside is expensive.
+ * The space is divided in cubic cells of a given size. The status of a cell is computed once by the conservative
+ * BRep::CutStatusOfBoxByBounds on its sub-cells, e.g. from the Lipschitz bound of the level sets or the distance to the
+ * boundary of the OCCBRep. The points in a cell proven completely inside or outside take the status of the cell without
+ * calling IsInside; IsInside is only called for the points in the other cells.
+ * The status of the cells is kept in a fixed size open addressing table of atomic slots, hence the cache is read and
+ * filled by concurrent threads without locking. When the table is full, the new cells are not classified anymore and
+ * their points call IsInside directly. The cache assumes the BRep does not change; otherwise Clear must be called.
+*/
+template<class TFunction>
+class CachedHeavisideFunction : public TFunction
+{
+public:
+    ///@name Type Definitions
+    ///@{
+
+    /// Pointer definition of CachedHeavisideFunction
+    KRATOS_CLASS_POINTER_DEFINITION(CachedHeavisideFunction);
+
+    typedef TFunction BaseType;
+
+    typedef typename BaseType::InputType InputType;
+
+    typedef typename BaseType::OutputType OutputType;
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// Number of slots of the table of the cell status
+    static const std::size_t CacheCapacity = 1 << 20;
+
+    /// Maximum number of cells in the table, to keep the probe sequences short
+    static const std::size_t MaxNumberOfCachedCells = (CacheCapacity / 4) * 3;
+
+    /// Constructor with the size of the cells. The status of a cell is evaluated on the whole cell.
+    CachedHeavisideFunction(const BRep::Pointer p_brep, const double& CellSize)
+    : BaseType(), mp_brep(p_brep), mCellSize(CellSize), mNumberOfSamplingPoints(2)
+    {
+        this->CheckParameters();
+        this->InitializeCache();
+    }
+
+    /// Constructor with the size of the cells and the number of sampling points of a cell in each direction. The cell is
+    /// divided in NumberOfSamplingPoints-1 sub-cells in each direction, which are classified separately; the smaller
+    /// sub-cells give a sharper Lipschitz bound.
+    CachedHeavisideFunction(const BRep::Pointer p_brep, const double& CellSize, const std::size_t& NumberOfSamplingPoints)
+    : BaseType(), mp_brep(p_brep), mCellSize(CellSize), mNumberOfSamplingPoints(NumberOfSamplingPoints)
+    {
+        this->CheckParameters();
+        this->InitializeCache();
+    }
+
+    /// Default constructor, only used by the serializer.
+    CachedHeavisideFunction() : BaseType(), mCellSize(1.0), mNumberOfSamplingPoints(2)
+    {
+        this->InitializeCache();
+    }
+
+    /// Copy constructor. The cache is not copied.
+    CachedHeavisideFunction(CachedHeavisideFunction const& rOther)
+    : BaseType(rOther), mp_brep(rOther.mp_brep), mCellSize(rOther.mCellSize)
+    , mNumberOfSamplingPoints(rOther.mNumberOfSamplingPoints)
+    {
+        this->InitializeCache();
+    }
+
+    /// Destructor.
+    virtual ~CachedHeavisideFunction()
+    {}
+
+
+    ///@}
+    ///@name Operators
+    ///@{
+
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+
+    virtual typename BaseType::Pointer CloneFunction() const
+    {
+        return typename BaseType::Pointer(new CachedHeavisideFunction(*this));
+    }
+
+
+    virtual double GetValue(const InputType& P) const
+    {
+        const int stat = this->GetCellStatus(this->GetCell(P));
+        if(stat == BRep::_IN)
+            return 1.0;
+        else if(stat == BRep::_OUT)
+            return 0.0;
+
+        if(mp_brep->IsInside(P))
+            return 1.0;
+        else
+            return 0.0;
+    }
+
+
+    virtual typename BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        return typename BaseType::DualType(this->GetValue(P));
+    }
+
+
+    virtual typename BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        return typename BaseType::GradientDualType(this->GetValue(P));
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual std::string GetFormula(const std::string& Format) const
+    {
+        return "H(L)";
+    }
+
+
+    virtual typename BaseType::Pointer GetDiffFunction(const int& component) const
+    {
+        return typename BaseType::Pointer(new ZeroFunction<TFunction>());
+    }
+
+
+    /// Clear the cache, e.g. when the BRep is changed. This must not be called during the evaluation.
+    void Clear()
+    {
+        for(std::size_t i = 0; i < CacheCapacity; ++i)
+            mCellStatus[i].store(0, std::memory_order_relaxed);
+        mNumberOfCachedCells.store(0);
+    }
+
+
+    ///@}
+    ///@name Access
+    ///@{
+
+
+    /// Get the number of cells in the cache
+    std::size_t NumberOfCachedCells() const
+    {
+        return mNumberOfCachedCells.load();
+    }
+
+
+    ///@}
+    ///@name Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Input and output
+    ///@{
+
+    /// Turn back information as a string.
+    virtual std::string Info() const
+    {
+        return "Cached Heaviside Function";
+    }
+
+    /// Print information about this object.
+    virtual void PrintInfo(std::ostream& rOStream) const
+    {
+        rOStream << Info();
+    }
+
+    /// Print object's data.
+    virtual void PrintData(std::ostream& rOStream) const
+    {
+        rOStream << " Cell size: " << mCellSize << std::endl;
+        rOStream << " Number of sampling points: " << mNumberOfSamplingPoints << std::endl;
+        rOStream << " Number of cached cells: " << this->NumberOfCachedCells();
+    }
+
+
+    ///@}
+    ///@name Friends
+    ///@{
+
+
+    ///@}
+
+protected:
+    ///@name Protected static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Protected member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Protected Operators
+    ///@{
+
+
+    ///@}
+    ///@name Protected Operations
+    ///@{
+
+
+    ///@}
+    ///@name Protected  Access
+    ///@{
+
+
+    ///@}
+    ///@name Protected Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Protected LifeCycle
+    ///@{
+
+
+    ///@}
+
+private:
+    ///@name Static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Member Variables
+    ///@{
+
+    /// Index of a cell of the grid
+    struct CellKey
+    {
+        long i, j, k;
+    };
+
+    /// A slot of the table packs the cell index, 20 bits per direction, the status in bits 60-61 and the occupied flag in bit 63.
+    /// An empty slot is 0.
+    static const int IndexBits = 20;
+    static const long IndexOffset = 1L << (IndexBits - 1);
+    static const std::uint64_t IndexMask = (static_cast<std::uint64_t>(1) << IndexBits) - 1;
+    static const std::uint64_t OccupiedFlag = static_cast<std::uint64_t>(1) << 63;
+    static const std::uint64_t KeyMask = OccupiedFlag | ((static_cast<std::uint64_t>(1) << (3*IndexBits)) - 1);
+
+    BRep::Pointer mp_brep;
+    LevelSet::Pointer mp_level_set; // the BRep if it is a level set, as loaded by the serializer
+    double mCellSize;
+    std::size_t mNumberOfSamplingPoints;
+
+    std::unique_ptr<std::atomic<std::uint64_t>[]> mCellStatus;
+    mutable std::atomic<std::size_t> mNumberOfCachedCells;
+
+    ///@}
+    ///@name Private Operators
+    ///@{
+
+
+    ///@}
+    ///@name Private Operations
+    ///@{
+
+    friend class Serializer;
+
+    /// The cache is not saved
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        LevelSet::SaveBRep(rSerializer, "BRep", mp_brep);
+        rSerializer.save("CellSize", mCellSize);
+        rSerializer.save("NumberOfSamplingPoints", mNumberOfSamplingPoints);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        LevelSet::LoadBRep(rSerializer, "BRep", mp_brep, mp_level_set);
+        rSerializer.load("CellSize", mCellSize);
+        rSerializer.load("NumberOfSamplingPoints", mNumberOfSamplingPoints);
+        this->Clear();
+    }
+
+
+    void CheckParameters() const
+    {
+        if(!(mCellSize > 0.0))
+            KRATOS_THROW_ERROR(std::logic_error, "The cell size must be positive, given:", mCellSize)
+
+        if(mNumberOfSamplingPoints < 2)
+            KRATOS_THROW_ERROR(std::logic_error, "The number of sampling points must be at least 2, given:", mNumberOfSamplingPoints)
+    }
+
+
+    void InitializeCache()
+    {
+        mCellStatus.reset(new std::atomic<std::uint64_t>[CacheCapacity]);
+        this->Clear();
+    }
+
+
+    CellKey GetCell(const InputType& P) const
+    {
+        CellKey Cell;
+        Cell.i = static_cast<long>(std::floor(P[0] / mCellSize));
+        Cell.j = static_cast<long>(std::floor(P[1] / mCellSize));
+        Cell.k = static_cast<long>(std::floor(P[2] / mCellSize));
+        return Cell;
+    }
+
+
+    /// Pack the index of a cell to the key of a slot. Return false if the index is out of the range of the table.
+    static bool PackCell(const CellKey& Cell, std::uint64_t& rKey)
+    {
+        if(Cell.i < -IndexOffset || Cell.i >= IndexOffset || Cell.j < -IndexOffset || Cell.j >= IndexOffset
+            || Cell.k < -IndexOffset || Cell.k >= IndexOffset)
+            return false;
+
+        rKey = OccupiedFlag
+             | static_cast<std::uint64_t>(Cell.i + IndexOffset)
+             | (static_cast<std::uint64_t>(Cell.j + IndexOffset) << IndexBits)
+             | (static_cast<std::uint64_t>(Cell.k + IndexOffset) << (2*IndexBits));
+        return true;
+    }
+
+
+    /// Initial slot of a key in the table
+    static std::size_t GetSlot(std::uint64_t Key)
+    {
+        Key ^= Key >> 33;
+        Key *= 0xff51afd7ed558ccdULL;
+        Key ^= Key >> 33;
+        return static_cast<std::size_t>(Key & (CacheCapacity - 1));
+    }
+
+
+    /// Get the status of a cell from the cache, or compute and insert it. The slots are read and claimed atomically, two
+    /// threads may compute the same cell at the same time but only one inserts it.
+    int GetCellStatus(const CellKey& Cell) const
+    {
+        std::uint64_t Key;
+        if(!PackCell(Cell, Key))
+            return BRep::_CUT;
+
+        std::size_t slot = GetSlot(Key);
+        for(std::size_t probe = 0; probe < CacheCapacity; ++probe, slot = (slot + 1) & (CacheCapacity - 1))
+        {
+            std::uint64_t value = mCellStatus[slot].load(std::memory_order_acquire);
+            if(value == 0)
+                break;
+            if((value & KeyMask) == Key)
+                return static_cast<int>((value >> (3*IndexBits)) & 3) - 1;
+        }
+
+        if(mNumberOfCachedCells.load(std::memory_order_relaxed) >= MaxNumberOfCachedCells)
+            return BRep::_CUT;
+
+        const int stat = this->ComputeCellStatus(Cell);
+        const std::uint64_t NewValue = Key | (static_cast<std::uint64_t>(stat + 1) << (3*IndexBits));
+
+        slot = GetSlot(Key);
+        for(std::size_t probe = 0; probe < CacheCapacity; ++probe, slot = (slot + 1) & (CacheCapacity - 1))
+        {
+            std::uint64_t value = 0;
+            if(mCellStatus[slot].compare_exchange_strong(value, NewValue, std::memory_order_acq_rel))
+            {
+                ++mNumberOfCachedCells;
+                break;
+            }
+            if((value & KeyMask) == Key)
+                break;
+        }
+
+        return stat;
+    }
+
+
+    /// Compute the status of a cell from its sub-cells. The cell is inside (outside) only if all its sub-cells are
+    /// proven inside (outside), otherwise it is cut.
+    int ComputeCellStatus(const CellKey& Cell) const
+    {
+        const std::size_t n = mNumberOfSamplingPoints - 1;
+        const double h = mCellSize / n;
+
+        int stat = BRep::_CUT;
+        BRep::PointType Min, Max;
+        for(std::size_t i = 0; i < n; ++i)
+            for(std::size_t j = 0; j < n; ++j)
+                for(std::size_t k = 0; k < n; ++k)
+                {
+                    Min[0] = Cell.i * mCellSize + i * h;
+                    Min[1] = Cell.j * mCellSize + j * h;
+                    Min[2] = Cell.k * mCellSize + k * h;
+                    Max[0] = Cell.i * mCellSize + (i+1) * h;
+                    Max[1] = Cell.j * mCellSize + (j+1) * h;
+                    Max[2] = Cell.k * mCellSize + (k+1) * h;
+
+                    const int sub_stat = mp_brep->CutStatusOfBoxByBounds(Min, Max);
+                    if(sub_stat == BRep::_CUT)
+                        return BRep::_CUT;
+                    if(stat == BRep::_CUT)
+                        stat = sub_stat;
+                    else if(stat != sub_stat)
+                        return BRep::_CUT;
+                }
+
+        return stat;
+    }
+
+
+    ///@}
+    ///@name Private  Access
+    ///@{
+
+
+    ///@}
+    ///@name Private Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Un accessible methods
+    ///@{
+
+    /// Assignment operator.
+    CachedHeavisideFunction& operator=(CachedHeavisideFunction const& rOther);
+
+    ///@}
+
+}; // Class CachedHeavisideFunction
+
+template<class TFunction>
+const std::size_t CachedHeavisideFunction<TFunction>::CacheCapacity;
+
+template<class TFunction>
+const std::size_t CachedHeavisideFunction<TFunction>::MaxNumberOfCachedCells;
+
+///@}
+
+///@name Type Definitions
+///@{
+
+
+///@}
+///@name Input and output
+///@{
+
+
+/// input stream function
+template<class TFunction>
+inline std::istream& operator >> (std::istream& rIStream, CachedHeavisideFunction<TFunction>& rThis)
+{}
+
+/// output stream function
+template<class TFunction>
+inline std::ostream& operator << (std::ostream& rOStream, const CachedHeavisideFunction<TFunction>& rThis)
+{
+    rThis.PrintInfo(rOStream);
+    rOStream << std::endl;
+    rThis.PrintData(rOStream);
+
+    return rOStream;
+}
+///@}
+
+///@} addtogroup block
+
+}  // namespace Kratos.
+
+#endif // KRATOS_CACHED_HEAVISIDE_FUNCTION_H_INCLUDED  defined
@@ -0,0 +1,346 @@
+//    |  /           |
+//    ' /   __| _` | __|  _ \   __|
+//    . \  |   (   | |   (   |\__ `
+//   _|\_\_|  \__,_|\__|\___/ ____/
+//                   Multi-Physics
+//
+//  License:         brep_application/LICENSE.txt
+//                   Kratos default license: kratos/license.txt
+//
+//  Main authors:    Hoang-Giang Bui
+//  Date:            16 Oct 2026
+//
+
+
+#if !defined(KRATOS_COMPILED_FUNCTION_H_INCLUDED )
+#define  KRATOS_COMPILED_FUNCTION_H_INCLUDED
+
+
+
+// System includes
+#include <string>
+#include <iostream>
+
+
+// External includes
+
+
+// Project includes
+#include "includes/define.h"
+#include "custom_algebra/function/function.h"
+#include "custom_algebra/function/function_tape.h"
+
+
+namespace Kratos
+{
+///@addtogroup BRepApplication
+///@{
+
+///@name Kratos Globals
+///@{
+
+///@}
+///@name Type Definitions
+///@{
+
+///@}
+///@name  Enum's
+///@{
+
+///@}
+///@name  CompiledFunction
+///@{
+
+///@}
+///@name Kratos Classes
+///@{
+
+/// Short class definition.
+/** Class for a scalar function which is compiled to a flat evaluation tape. The function tree is walked once at construction,
+ * after that the evaluation runs through the tape without virtual calls, except for the nodes which can't be compiled.
+ * The compiled function owns the original tree, which is used for the derivatives and the formula.
+*/
+template<class TFunction>
+class CompiledFunction : public TFunction
+{
+public:
+    ///@name Type Definitions
+    ///@{
+
+    /// Pointer definition of CompiledFunction
+    KRATOS_CLASS_POINTER_DEFINITION(CompiledFunction);
+
+    typedef TFunction BaseType;
+
+    typedef typename BaseType::InputType InputType;
+
+    typedef typename BaseType::OutputType OutputType;
+
+    typedef FunctionTape<InputType, OutputType> TapeType;
+
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// Default constructor.
+    CompiledFunction(const typename BaseType::Pointer p_func)
+    : BaseType(), mp_func(p_func)
+    {
+        mOutput = mp_func->Compile(mTape);
+    }
+
+    /// Default constructor, only used by the serializer.
+    CompiledFunction() : BaseType(), mOutput(0)
+    {}
+
+    /// Copy constructor.
+    CompiledFunction(CompiledFunction const& rOther)
+    : BaseType(rOther), mp_func(rOther.mp_func->CloneFunction())
+    {
+        mOutput = mp_func->Compile(mTape);
+    }
+
+    /// Destructor.
+    virtual ~CompiledFunction()
+    {}
+
+
+    ///@}
+    ///@name Operators
+    ///@{
+
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+
+    virtual typename BaseType::Pointer CloneFunction() const
+    {
+        return typename BaseType::Pointer(new CompiledFunction(*this));
+    }
+
+
+    virtual OutputType GetValue(const InputType& P) const
+    {
+        return mTape.GetValue(P, mOutput);
+    }
+
+
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        mTape.GetValues(P, n, Values, mOutput);
+    }
+
+
+    virtual std::size_t Compile(TapeType& rTape) const
+    {
+        return mp_func->Compile(rTape);
+    }
+
+
+    virtual typename BaseType::Pointer SimplifyFunction(typename BaseType::SimplifyData& rData) const
+    {
+        return typename BaseType::Pointer(new CompiledFunction(mp_func->Simplify(rData)));
+    }
+
+
+    virtual std::string GetFormula(const std::string& Format) const
+    {
+        return mp_func->GetFormula(Format);
+    }
+
+
+    virtual typename BaseType::Pointer GetDiffFunction(const int& component) const
+    {
+        return typename BaseType::Pointer(new CompiledFunction(mp_func->GetDiffFunction(component)));
+    }
+
+
+    ///@}
+    ///@name Access
+    ///@{
+
+
+    const TapeType& GetTape() const
+    {
+        return mTape;
+    }
+
+
+    /// Register of the tape which holds the value of the function
+    std::size_t GetOutputRegister() const
+    {
+        return mOutput;
+    }
+
+
+    ///@}
+    ///@name Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Input and output
+    ///@{
+
+    /// Turn back information as a string.
+    virtual std::string Info() const
+    {
+        return "Compiled Function of " + mp_func->Info();
+    }
+
+    /// Print information about this object.
+    virtual void PrintInfo(std::ostream& rOStream) const
+    {
+        rOStream << Info();
+    }
+
+    /// Print object's data.
+    virtual void PrintData(std::ostream& rOStream) const
+    {
+        rOStream << " Number of instructions: " << mTape.Size() << std::endl;
+        rOStream << " Number of opaque calls: " << mTape.NumberOfCalls() << std::endl;
+        rOStream << " Output register: r" << mOutput << std::endl;
+        mTape.PrintData(rOStream);
+    }
+
+
+    ///@}
+    ///@name Friends
+    ///@{
+
+
+    ///@}
+
+protected:
+    ///@name Protected static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Protected member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Protected Operators
+    ///@{
+
+
+    ///@}
+    ///@name Protected Operations
+    ///@{
+
+
+    ///@}
+    ///@name Protected  Access
+    ///@{
+
+
+    ///@}
+    ///@name Protected Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Protected LifeCycle
+    ///@{
+
+
+    ///@}
+
+private:
+    ///@name Static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Member Variables
+    ///@{
+
+    typename BaseType::Pointer mp_func;
+    TapeType mTape;
+    std::size_t mOutput;
+
+    ///@}
+    ///@name Private Operators
+    ///@{
+
+
+    ///@}
+    ///@name Private Operations
+    ///@{
+
+    friend class Serializer;
+
+    /// The tape is not saved, but compiled again from the function when it is loaded
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("Function", mp_func);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("Function", mp_func);
+        mTape.Clear();
+        mOutput = mp_func->Compile(mTape);
+    }
+
+    ///@}
+    ///@name Private  Access
+    ///@{
+
+
+    ///@}
+    ///@name Private Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Un accessible methods
+    ///@{
+
+    /// Assignment operator.
+    CompiledFunction& operator=(CompiledFunction const& rOther);
+
+    ///@}
+
+}; // Class CompiledFunction
+
+///@}
+
+///@name Type Definitions
+///@{
+
+
+///@}
+///@name Input and output
+///@{
+
+
+/// input stream CompiledFunction
+template<class TFunction>
+inline std::istream& operator >> (std::istream& rIStream, CompiledFunction<TFunction>& rThis)
+{}
+
+/// output stream CompiledFunction
+template<class TFunction>
+inline std::ostream& operator << (std::ostream& rOStream, const CompiledFunction<TFunction>& rThis)
+{
+    rThis.PrintInfo(rOStream);
+    rOStream << std::endl;
+    rThis.PrintData(rOStream);
+
+    return rOStream;
+}
+///@}
+
+///@} addtogroup block
+
+}  // namespace Kratos.
+
+#endif // KRATOS_COMPILED_FUNCTION_H_INCLUDED  defined
@@ -136,6 +136,21 @@ public:
     }
 
 
+    /// Evaluate the spline at a batch of points. The intervals are walked if the points are sorted.
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        mS.eval_sorted(P, n, TDerivDegree, Values, NULL, NULL);
+    }
+
+
+    /// Evaluate the spline and its derivatives at a batch of points in one sweep over the intervals
+    virtual void GetValuesAndDerivatives(const InputType* P, const std::size_t n, OutputType* Values,
+            OutputType* Derivatives, OutputType* SecondDerivatives) const
+    {
+        mS.eval_sorted(P, n, TDerivDegree, Values, Derivatives, SecondDerivatives);
+    }
+
+
     virtual double GetDerivative(const int& component, const InputType& P) const
     {
         return mS.deriv(TDerivDegree+1, P);
@@ -148,6 +163,24 @@ public:
     }
 
 
+    virtual BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        return BaseType::DualType::Variable(P, 0).Compose(this->GetValue(P), this->GetDerivative(0, P), this->GetSecondDerivative(0, 0, P));
+    }
+
+
+    virtual BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        return BaseType::GradientDualType::Variable(P, 0).Compose(this->GetValue(P), this->GetDerivative(0, P), 0.0);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
     // virtual FunctionR1R1::Pointer GetDiffFunction(const int& component) const
     // {
     //     typename CubicSplineFunction<TDerivDegree+1>::Pointer pFunc = boost::make_shared<CubicSplineFunction<TDerivDegree+1> >();
@@ -258,6 +291,24 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    /// The coefficients are saved, hence the spline is not fitted again when it is loaded
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        std::vector<double> state;
+        mS.get_state(state);
+        rSerializer.save("Spline", state);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        std::vector<double> state;
+        rSerializer.load("Spline", state);
+        mS.set_state(state);
+    }
 
     ///@}
     ///@name Private  Access
@@ -306,6 +357,19 @@ public:
     }
 
 
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        mS.eval_sorted(P, n, 3, Values, NULL, NULL);
+    }
+
+
+    virtual void GetValuesAndDerivatives(const InputType* P, const std::size_t n, OutputType* Values,
+            OutputType* Derivatives, OutputType* SecondDerivatives) const
+    {
+        mS.eval_sorted(P, n, 3, Values, Derivatives, SecondDerivatives);
+    }
+
+
     virtual double GetSecondDerivative(const int& component_1, const int& component_2, const InputType& P) const
     {
         return mS.deriv(5, P);
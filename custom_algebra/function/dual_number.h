@@ -0,0 +1,435 @@
+//    |  /           |
+//    ' /   __| _` | __|  _ \   __|
+//    . \  |   (   | |   (   |\__ `
+//   _|\_\_|  \__,_|\__|\___/ ____/
+//                   Multi-Physics
+//
+//  License:         brep_application/LICENSE.txt
+//                   Kratos default license: kratos/license.txt
+//
+//  Main authors:    Hoang-Giang Bui
+//  Date:            16 Oct 2026
+//
+
+
+#if !defined(KRATOS_DUAL_NUMBER_H_INCLUDED )
+#define  KRATOS_DUAL_NUMBER_H_INCLUDED
+
+
+
+// System includes
+#include <cmath>
+#include <iostream>
+
+
+// External includes
+
+
+// Project includes
+#include "includes/define.h"
+
+
+namespace Kratos
+{
+///@addtogroup BRepApplication
+///@{
+
+///@name Kratos Globals
+///@{
+
+///@}
+///@name Type Definitions
+///@{
+
+///@}
+///@name  Enum's
+///@{
+
+///@}
+///@name  Functions
+///@{
+
+///@}
+///@name Kratos Classes
+///@{
+
+/// Short class definition.
+/** Dual number on R^TDim. It carries the value, the gradient and, if TOrder is 2, the Hessian of a scalar quantity w.r.t
+ * the input variables, so that all of them are obtained in one pass of the function evaluation. The first order dual
+ * number carries no Hessian and is used when only the gradient is needed.
+*/
+template<std::size_t TDim, std::size_t TOrder = 2>
+class DualNumber
+{
+public:
+    ///@name Type Definitions
+    ///@{
+
+    /// Size of the Hessian storage, which is not used by the first order dual number
+    static const std::size_t HessianSize = (TOrder > 1) ? TDim : 1;
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// Default constructor.
+    DualNumber() : mValue(0.0)
+    {
+        SetZeroDerivatives();
+    }
+
+    /// Constructor of a constant.
+    DualNumber(const double& value) : mValue(value)
+    {
+        SetZeroDerivatives();
+    }
+
+    /// Destructor.
+    ~DualNumber() {}
+
+
+    /// Create the independent variable i with the given value
+    static DualNumber Variable(const double& value, const std::size_t& i)
+    {
+        DualNumber v(value);
+        v.mGradient[i] = 1.0;
+        return v;
+    }
+
+
+    ///@}
+    ///@name Operators
+    ///@{
+
+    DualNumber& operator+=(const DualNumber& rOther)
+    {
+        mValue += rOther.mValue;
+        for (std::size_t i = 0; i < TDim; ++i)
+            mGradient[i] += rOther.mGradient[i];
+        if (TOrder > 1)
+            for (std::size_t i = 0; i < TDim; ++i)
+                for (std::size_t j = 0; j < TDim; ++j)
+                    mHessian[i][j] += rOther.mHessian[i][j];
+        return *this;
+    }
+
+    DualNumber& operator-=(const DualNumber& rOther)
+    {
+        mValue -= rOther.mValue;
+        for (std::size_t i = 0; i < TDim; ++i)
+            mGradient[i] -= rOther.mGradient[i];
+        if (TOrder > 1)
+            for (std::size_t i = 0; i < TDim; ++i)
+                for (std::size_t j = 0; j < TDim; ++j)
+                    mHessian[i][j] -= rOther.mHessian[i][j];
+        return *this;
+    }
+
+    DualNumber& operator*=(const DualNumber& rOther)
+    {
+        if (TOrder > 1)
+            for (std::size_t i = 0; i < TDim; ++i)
+                for (std::size_t j = 0; j < TDim; ++j)
+                    mHessian[i][j] = mValue*rOther.mHessian[i][j] + rOther.mValue*mHessian[i][j]
+                                   + mGradient[i]*rOther.mGradient[j] + rOther.mGradient[i]*mGradient[j];
+        for (std::size_t i = 0; i < TDim; ++i)
+            mGradient[i] = mValue*rOther.mGradient[i] + rOther.mValue*mGradient[i];
+        mValue *= rOther.mValue;
+        return *this;
+    }
+
+    DualNumber& operator/=(const DualNumber& rOther)
+    {
+        const double inv = 1.0 / rOther.mValue;
+        return (*this) *= rOther.Compose(inv, -inv*inv, 2.0*inv*inv*inv);
+    }
+
+    DualNumber& operator+=(const double& a)
+    {
+        mValue += a;
+        return *this;
+    }
+
+    DualNumber& operator-=(const double& a)
+    {
+        mValue -= a;
+        return *this;
+    }
+
+    DualNumber& operator*=(const double& a)
+    {
+        mValue *= a;
+        for (std::size_t i = 0; i < TDim; ++i)
+            mGradient[i] *= a;
+        if (TOrder > 1)
+            for (std::size_t i = 0; i < TDim; ++i)
+                for (std::size_t j = 0; j < TDim; ++j)
+                    mHessian[i][j] *= a;
+        return *this;
+    }
+
+    DualNumber& operator/=(const double& a)
+    {
+        return (*this) *= (1.0 / a);
+    }
+
+    DualNumber operator-() const
+    {
+        DualNumber r(*this);
+        r *= -1.0;
+        return r;
+    }
+
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+
+    /// Apply a scalar function f to this number by the chain rule, given f, f' and f'' at the value of this number.
+    /// f'' is not used by the first order dual number.
+    DualNumber Compose(const double& f, const double& df, const double& ddf) const
+    {
+        DualNumber r;
+        r.mValue = f;
+        for (std::size_t i = 0; i < TDim; ++i)
+            r.mGradient[i] = df*mGradient[i];
+        if (TOrder > 1)
+            for (std::size_t i = 0; i < TDim; ++i)
+                for (std::size_t j = 0; j < TDim; ++j)
+                    r.mHessian[i][j] = df*mHessian[i][j] + ddf*mGradient[i]*mGradient[j];
+        return r;
+    }
+
+
+    /// The elementary functions are found by argument dependent lookup, hence they don't hide the ones in cmath
+    friend DualNumber sin(const DualNumber& a)
+    {
+        const double s = std::sin(a.mValue);
+        return a.Compose(s, std::cos(a.mValue), -s);
+    }
+
+    friend DualNumber cos(const DualNumber& a)
+    {
+        const double c = std::cos(a.mValue);
+        return a.Compose(c, -std::sin(a.mValue), -c);
+    }
+
+    friend DualNumber acos(const DualNumber& a)
+    {
+        const double x = a.mValue;
+        const double r = 1.0 - x*x;
+        const double df = -1.0 / std::sqrt(r);
+        return a.Compose(std::acos(x), df, df*x/r);
+    }
+
+    friend DualNumber sqrt(const DualNumber& a)
+    {
+        const double s = std::sqrt(a.mValue);
+        return a.Compose(s, 0.5/s, -0.25/(s*a.mValue));
+    }
+
+    friend DualNumber pow(const DualNumber& a, const double& b)
+    {
+        const double x = a.mValue;
+        if (b == 0.0)
+            return DualNumber(1.0);
+        else if (b == 1.0)
+            return a;
+        else if (b == 2.0)
+            return a.Compose(x*x, 2.0*x, 2.0);
+
+        // the factors are computed separately, since pow(x, b-2) is not finite at x = 0 for b < 2 while the value
+        // and the first derivative may be, e.g. b = 1.5
+        const double f = std::pow(x, b);
+        const double df = b*std::pow(x, b-1.0);
+        const double ddf = (TOrder > 1) ? b*(b-1.0)*std::pow(x, b-2.0) : 0.0;
+        if (x != 0.0)
+            return a.Compose(f, df, ddf);
+
+        // at a zero base the unbounded factors are only applied to the non-zero derivatives of a
+        DualNumber r(f);
+        for (std::size_t i = 0; i < TDim; ++i)
+            if (a.mGradient[i] != 0.0)
+                r.mGradient[i] = df*a.mGradient[i];
+        if (TOrder > 1)
+            for (std::size_t i = 0; i < TDim; ++i)
+                for (std::size_t j = 0; j < TDim; ++j)
+                {
+                    if (a.mHessian[i][j] != 0.0)
+                        r.mHessian[i][j] += df*a.mHessian[i][j];
+                    if (a.mGradient[i]*a.mGradient[j] != 0.0)
+                        r.mHessian[i][j] += ddf*a.mGradient[i]*a.mGradient[j];
+                }
+        return r;
+    }
+
+
+    ///@}
+    ///@name Access
+    ///@{
+
+    double& Value() {return mValue;}
+    const double& Value() const {return mValue;}
+
+    double& Gradient(const std::size_t& i) {return mGradient[i];}
+    const double& Gradient(const std::size_t& i) const {return mGradient[i];}
+
+    /// The Hessian is only available for the second order dual number
+    double& Hessian(const std::size_t& i, const std::size_t& j) {return mHessian[i][j];}
+    const double& Hessian(const std::size_t& i, const std::size_t& j) const {return mHessian[i][j];}
+
+    static inline std::size_t Dimension() {return TDim;}
+
+    static inline std::size_t Order() {return TOrder;}
+
+    ///@}
+    ///@name Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Input and output
+    ///@{
+
+    /// Print information about this object.
+    void PrintInfo(std::ostream& rOStream) const
+    {
+        rOStream << "DualNumber<" << TDim << ", " << TOrder << ">";
+    }
+
+    /// Print object's data.
+    void PrintData(std::ostream& rOStream) const
+    {
+        rOStream << " value: " << mValue << std::endl;
+        rOStream << " gradient:";
+        for (std::size_t i = 0; i < TDim; ++i)
+            rOStream << " " << mGradient[i];
+        if (TOrder > 1)
+        {
+            rOStream << std::endl;
+            rOStream << " hessian:";
+            for (std::size_t i = 0; i < TDim; ++i)
+                for (std::size_t j = 0; j < TDim; ++j)
+                    rOStream << " " << mHessian[i][j];
+        }
+    }
+
+    ///@}
+
+private:
+    ///@name Member Variables
+    ///@{
+
+    double mValue;
+    double mGradient[TDim];
+    double mHessian[HessianSize][HessianSize];
+
+    ///@}
+    ///@name Private Operations
+    ///@{
+
+    void SetZeroDerivatives()
+    {
+        for (std::size_t i = 0; i < TDim; ++i)
+            mGradient[i] = 0.0;
+        for (std::size_t i = 0; i < HessianSize; ++i)
+            for (std::size_t j = 0; j < HessianSize; ++j)
+                mHessian[i][j] = 0.0;
+    }
+
+    ///@}
+
+}; // Class DualNumber
+
+template<std::size_t TDim, std::size_t TOrder>
+const std::size_t DualNumber<TDim, TOrder>::HessianSize;
+
+///@}
+
+///@name Type Definitions
+///@{
+
+/// Traits to extract the dimension and the components of the input of a function
+template<typename TInputType>
+struct DualNumberTraits;
+
+template<>
+struct DualNumberTraits<double>
+{
+    static const std::size_t Dimension = 1;
+    static inline const double& Component(const double& P, const std::size_t& i) {return P;}
+};
+
+template<std::size_t TDim>
+struct DualNumberTraits<array_1d<double, TDim> >
+{
+    static const std::size_t Dimension = TDim;
+    static inline const double& Component(const array_1d<double, TDim>& P, const std::size_t& i) {return P[i];}
+};
+
+///@}
+///@name Operations
+///@{
+
+template<std::size_t TDim, std::size_t TOrder>
+inline DualNumber<TDim, TOrder> operator+(DualNumber<TDim, TOrder> a, const DualNumber<TDim, TOrder>& b) {return a += b;}
+
+template<std::size_t TDim, std::size_t TOrder>
+inline DualNumber<TDim, TOrder> operator-(DualNumber<TDim, TOrder> a, const DualNumber<TDim, TOrder>& b) {return a -= b;}
+
+template<std::size_t TDim, std::size_t TOrder>
+inline DualNumber<TDim, TOrder> operator*(DualNumber<TDim, TOrder> a, const DualNumber<TDim, TOrder>& b) {return a *= b;}
+
+template<std::size_t TDim, std::size_t TOrder>
+inline DualNumber<TDim, TOrder> operator/(DualNumber<TDim, TOrder> a, const DualNumber<TDim, TOrder>& b) {return a /= b;}
+
+template<std::size_t TDim, std::size_t TOrder>
+inline DualNumber<TDim, TOrder> operator+(DualNumber<TDim, TOrder> a, const double& b) {return a += b;}
+
+template<std::size_t TDim, std::size_t TOrder>
+inline DualNumber<TDim, TOrder> operator+(const double& a, DualNumber<TDim, TOrder> b) {return b += a;}
+
+template<std::size_t TDim, std::size_t TOrder>
+inline DualNumber<TDim, TOrder> operator-(DualNumber<TDim, TOrder> a, const double& b) {return a -= b;}
+
+template<std::size_t TDim, std::size_t TOrder>
+inline DualNumber<TDim, TOrder> operator-(const double& a, const DualNumber<TDim, TOrder>& b) {return (-b) += a;}
+
+template<std::size_t TDim, std::size_t TOrder>
+inline DualNumber<TDim, TOrder> operator*(DualNumber<TDim, TOrder> a, const double& b) {return a *= b;}
+
+template<std::size_t TDim, std::size_t TOrder>
+inline DualNumber<TDim, TOrder> operator*(const double& a, DualNumber<TDim, TOrder> b) {return b *= a;}
+
+template<std::size_t TDim, std::size_t TOrder>
+inline DualNumber<TDim, TOrder> operator/(DualNumber<TDim, TOrder> a, const double& b) {return a /= b;}
+
+template<std::size_t TDim, std::size_t TOrder>
+inline DualNumber<TDim, TOrder> operator/(const double& a, const DualNumber<TDim, TOrder>& b)
+{
+    const double inv = 1.0 / b.Value();
+    return b.Compose(a*inv, -a*inv*inv, 2.0*a*inv*inv*inv);
+}
+
+///@}
+///@name Input and output
+///@{
+
+/// output stream function
+template<std::size_t TDim, std::size_t TOrder>
+inline std::ostream& operator << (std::ostream& rOStream, const DualNumber<TDim, TOrder>& rThis)
+{
+    rThis.PrintInfo(rOStream);
+    rOStream << std::endl;
+    rThis.PrintData(rOStream);
+
+    return rOStream;
+}
+///@}
+
+///@} addtogroup block
+
+}  // namespace Kratos.
+
+#endif // KRATOS_DUAL_NUMBER_H_INCLUDED  defined
@@ -19,6 +19,10 @@
 
 // System includes
 #include <string>
+#include <map>
+#include <vector>
+#include <mutex>
+#include <atomic>
 #include <sstream>
 #include <iostream>
 
@@ -29,7 +33,12 @@
 // Project includes
 #include "includes/define.h"
 #include "includes/element.h"
+#include "includes/model_part.h"
 #include "includes/serializer.h"
+#include "utilities/openmp_utils.h"
+#include "custom_algebra/function/function_tape.h"
+#include "custom_algebra/function/dual_number.h"
+#include "custom_utilities/integration_points_cache.h"
 
 
 namespace Kratos
@@ -44,6 +53,56 @@ namespace Kratos
 ///@name Type Definitions
 ///@{
 
+/// Traits to accumulate the integral of a function. An empty Vector is the zero of any size.
+template<typename TOutputType>
+struct FunctionIntegrationTraits;
+
+template<>
+struct FunctionIntegrationTraits<double>
+{
+    static inline double Zero() {return 0.0;}
+    static inline void AddTo(double& rResult, const double& Value, const double& w) {rResult += w*Value;}
+};
+
+template<std::size_t TDim>
+struct FunctionIntegrationTraits<array_1d<double, TDim> >
+{
+    static inline array_1d<double, TDim> Zero()
+    {
+        array_1d<double, TDim> Result;
+        for(std::size_t i = 0; i < TDim; ++i)
+            Result[i] = 0.0;
+        return Result;
+    }
+
+    static inline void AddTo(array_1d<double, TDim>& rResult, const array_1d<double, TDim>& Value, const double& w)
+    {
+        for(std::size_t i = 0; i < TDim; ++i)
+            rResult[i] += w*Value[i];
+    }
+};
+
+template<>
+struct FunctionIntegrationTraits<Vector>
+{
+    static inline Vector Zero() {return Vector(0);}
+
+    static inline void AddTo(Vector& rResult, const Vector& Value, const double& w)
+    {
+        if(rResult.size() == 0)
+        {
+            rResult.resize(Value.size(), false);
+            noalias(rResult) = w*Value;
+        }
+        else if(Value.size() != 0)
+        {
+            if(rResult.size() != Value.size())
+                KRATOS_THROW_ERROR(std::logic_error, "Incompatible size of the function values:", Value.size())
+            noalias(rResult) += w*Value;
+        }
+    }
+};
+
 ///@}
 ///@name  Enum's
 ///@{
@@ -58,6 +117,10 @@ namespace Kratos
 
 /// Short class definition.
 /** Abstract class for a general function R^m->R^n
+ * The evaluation (GetValue, GetDerivative, GetGradient, ...) is const and reentrant, i.e. the same function can be
+ * evaluated from several threads. The derived classes shall keep their state immutable after the construction and use
+ * local scratch for the evaluation; the lazily created data, e.g. the cached derivative functions, is created under a mutex
+ * and read without locking once it is set.
 */
 template<typename TInputType, typename TOutputType>
 class Function
@@ -81,16 +144,44 @@ public:
 
     typedef typename NodeType::CoordinatesArrayType CoordinatesArrayType;
 
+    typedef DualNumberTraits<TInputType> DualTraitsType;
+
+    typedef DualNumber<DualTraitsType::Dimension> DualType;
+
+    /// The first order dual number, which carries the value and the gradient only
+    typedef DualNumber<DualTraitsType::Dimension, 1> GradientDualType;
+
+    /// The fixed-size gradient and Hessian of a scalar function
+    typedef array_1d<double, DualTraitsType::Dimension> GradientType;
+
+    typedef bounded_matrix<double, DualTraitsType::Dimension, DualTraitsType::Dimension> HessianType;
+
+    /// Data of the simplification pass. It maps the visited functions to their simplified functions, and the
+    /// key of the simplified functions to the instance shared by all the equivalent sub-expressions.
+    struct SimplifyData
+    {
+        std::map<const Function*, typename Function::Pointer> Visited;
+        std::map<std::string, typename Function::Pointer> Shared;
+    };
+
     ///@}
     ///@name Life Cycle
     ///@{
 
+    /// Maximum number of input components, i.e. the number of slots of the cache of the derivative functions
+    static const std::size_t MaxNumberOfComponents = 3;
+
     /// Default constructor.
-    Function() {}
+    Function()
+    {
+        this->InitializeDiffFunctions();
+    }
 
     /// Copy constructor.
     Function(Function const& rOther)
-    {}
+    {
+        this->InitializeDiffFunctions();
+    }
 
     /// Destructor.
     virtual ~Function() {}
@@ -130,17 +221,51 @@ public:
     }
 
 
+    /// Evaluate the function and write the result to rValue. The functions with a dynamic output shall override
+    /// this to reuse the storage of rValue instead of creating a new output for each call.
+    virtual void GetValue(const TInputType& P, TOutputType& rValue) const
+    {
+        rValue = this->GetValue(P);
+    }
+
+
+    /// Evaluate the function at a batch of n points. The values are written to Values, which must hold at least n entries.
+    /// Composite functions shall override this to evaluate each operand once over the whole batch instead of walking the tree per point.
+    virtual void GetValues(const TInputType* P, const std::size_t n, TOutputType* Values) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = this->GetValue(P[i]);
+    }
+
+
+    /// Evaluate the function and its first and second derivatives w.r.t the first component at a batch of n points.
+    /// It is meant for the functions of one variable, e.g. the curves sampled along the parameter. The functions
+    /// with an interval search shall override this to walk the intervals when the points are sorted.
+    /// Any of Values, Derivatives and SecondDerivatives can be NULL if it is not needed.
+    virtual void GetValuesAndDerivatives(const TInputType* P, const std::size_t n, TOutputType* Values,
+            TOutputType* Derivatives, TOutputType* SecondDerivatives) const
+    {
+        if(Values != NULL)
+            this->GetValues(P, n, Values);
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            if(Derivatives != NULL)
+                Derivatives[i] = this->GetDerivative(0, P[i]);
+            if(SecondDerivatives != NULL)
+                SecondDerivatives[i] = this->GetSecondDerivative(0, 0, P[i]);
+        }
+    }
+
+
     virtual TOutputType GetDerivative(const int& component, const TInputType& P) const
     {
-        Function::Pointer pDerivative = this->GetDiffFunction(component);
-        return pDerivative->GetValue(P);
+        return this->GetCachedDiffFunction(component)->GetValue(P);
     }
 
 
     virtual TOutputType GetSecondDerivative(const int& component_1, const int& component_2, const TInputType& P) const
     {
-        Function::Pointer pSecondDerivative = this->GetDiffFunction(component_1)->GetDiffFunction(component_2);
-        return pSecondDerivative->GetValue(P);
+        return this->GetCachedDiffFunction(component_1)->GetCachedDiffFunction(component_2)->GetValue(P);
     }
 
 
@@ -155,6 +280,70 @@ public:
     }
 
 
+    virtual boost::numeric::ublas::matrix<TOutputType> GetHessian(const TInputType& P) const
+    {
+        boost::numeric::ublas::matrix<TOutputType> Result(this->InputSize(), this->InputSize());
+        for(std::size_t c1 = 0; c1 < this->InputSize(); ++c1)
+        {
+            for(std::size_t c2 = 0; c2 < this->InputSize(); ++c2)
+            {
+                Result(c1, c2) = this->GetSecondDerivative(c1, c2, P);
+            }
+        }
+        return Result;
+    }
+
+
+    /// Compute the gradient of a scalar function into a fixed-size array, without heap allocation.
+    /// For the scalar functions, the heap version GetGradient(P) is an adapter of this.
+    virtual void GetGradient(const TInputType& P, GradientType& rGradient) const
+    {
+        KRATOS_THROW_ERROR(std::logic_error, "The fixed-size gradient is only available for scalar function", __FUNCTION__)
+    }
+
+
+    /// Compute the gradients of a scalar function at a batch of n points into fixed-size arrays.
+    /// The functions with a cheaper batched evaluation shall override this.
+    virtual void GetGradients(const TInputType* P, const std::size_t n, GradientType* Gradients) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            this->GetGradient(P[i], Gradients[i]);
+    }
+
+
+    /// Compute the Hessian of a scalar function into a fixed-size matrix, without heap allocation.
+    /// For the scalar functions, the heap version GetHessian(P) is an adapter of this.
+    virtual void GetHessian(const TInputType& P, HessianType& rHessian) const
+    {
+        KRATOS_THROW_ERROR(std::logic_error, "The fixed-size Hessian is only available for scalar function", __FUNCTION__)
+    }
+
+
+    /// Evaluate the value, the gradient and the Hessian of a scalar function in one pass using the dual numbers.
+    /// The derived classes shall override this to propagate the dual numbers of the operands; for the scalar functions
+    /// without an override, the derivatives are computed from the symbolic derivative functions.
+    virtual DualType GetDualValue(const TInputType& P) const
+    {
+        KRATOS_THROW_ERROR(std::logic_error, "The dual evaluation is only available for scalar function", __FUNCTION__)
+    }
+
+
+    /// Evaluate the value and the gradient of a scalar function in one pass using the first order dual numbers, which
+    /// do not carry the Hessian. The derived classes overriding GetDualValue shall override this in the same way.
+    virtual GradientDualType GetGradientDualValue(const TInputType& P) const
+    {
+        KRATOS_THROW_ERROR(std::logic_error, "The dual evaluation is only available for scalar function", __FUNCTION__)
+    }
+
+
+    /// Return true if GetDualValue and GetGradientDualValue propagate the dual numbers without the symbolic derivative
+    /// functions. Otherwise the derivatives are computed from their cached derivative functions rather than from the dual number.
+    virtual bool HasDualValue() const
+    {
+        return false;
+    }
+
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         KRATOS_THROW_ERROR(std::logic_error, "Call the base class", __FUNCTION__)
@@ -167,6 +356,79 @@ public:
     }
 
 
+    /// Return an equivalent function with constant folding, elimination of zero and identity operations, merging of
+    /// scales and sharing of the common sub-expressions.
+    Function::Pointer Simplify() const
+    {
+        SimplifyData Data;
+        return this->Simplify(Data);
+    }
+
+
+    /// Simplify this function within an ongoing simplification pass. A function shared by several parents is
+    /// simplified only once.
+    Function::Pointer Simplify(SimplifyData& rData) const
+    {
+        typename std::map<const Function*, typename Function::Pointer>::iterator it = rData.Visited.find(this);
+        if(it != rData.Visited.end())
+            return it->second;
+
+        Function::Pointer pSimplified = this->SimplifyFunction(rData);
+        rData.Visited[this] = pSimplified;
+        rData.Visited[pSimplified.get()] = pSimplified;
+        return pSimplified;
+    }
+
+
+    /// Create the simplified function. The operands shall be simplified with Simplify(rData).
+    /// By default the function is not simplified and only cloned.
+    virtual Function::Pointer SimplifyFunction(SimplifyData& rData) const
+    {
+        return this->CloneFunction();
+    }
+
+
+    /// Check if the function is constant. If it is, the constant value is returned in rValue.
+    virtual bool IsConstant(TOutputType& rValue) const
+    {
+        return false;
+    }
+
+
+    /// Get the derivative function w.r.t the component. The simplified derivative function is created at the first call and kept
+    /// by this function, so that the repeated evaluation of the derivatives does not rebuild the derivative tree.
+    /// The second derivatives are cached in the same way by the derivative function. This is thread-safe: a slot is written
+    /// once under the mutex before its flag is set, after that it is read without locking.
+    const Function::Pointer& GetCachedDiffFunction(const int& component) const
+    {
+        const std::size_t c = static_cast<std::size_t>(component);
+        if(c >= MaxNumberOfComponents)
+            KRATOS_THROW_ERROR(std::logic_error, "The component of the derivative is out of range:", component)
+
+        if(mIsDiffFunctionSet[c].load(std::memory_order_acquire))
+            return mpDiffFunctions[c];
+
+        // the derivative function is created outside of the lock, in case it needs the cache of this function
+        Function::Pointer pDerivative = this->GetDiffFunction(component)->Simplify();
+
+        std::lock_guard<std::mutex> lock(mDiffFunctionsMutex);
+        if(!mIsDiffFunctionSet[c].load(std::memory_order_relaxed))
+        {
+            mpDiffFunctions[c] = pDerivative;
+            mIsDiffFunctionSet[c].store(true, std::memory_order_release);
+        }
+        return mpDiffFunctions[c];
+    }
+
+
+    /// Emit the instructions evaluating this function to the tape and return the register holding the result.
+    /// By default the function is kept as an opaque call; the derived classes shall emit their own operations.
+    virtual std::size_t Compile(FunctionTape<TInputType, TOutputType>& rTape) const
+    {
+        return rTape.AddCall(this);
+    }
+
+
     TOutputType Integrate(Element::Pointer& p_elem) const
     {
         return Integrate(p_elem->GetGeometry());
@@ -195,6 +457,49 @@ public:
     }
 
 
+    /// Integrate a function over an element using the geometry data stored in the cache
+    TOutputType Integrate(const IntegrationPointsCache& rCache, const std::size_t& ElementId,
+            const GeometryData::IntegrationMethod ThisIntegrationMethod) const
+    {
+        KRATOS_THROW_ERROR(std::logic_error, "Integrate is not implemented", "")
+    }
+
+
+    /// Integrate the function over all the elements of a model part. The elements are integrated in parallel.
+    TOutputType IntegrateOverModelPart(ModelPart& r_model_part, const int integration_order) const
+    {
+        return IntegrateElements(r_model_part.Elements(), integration_order, NULL, NULL);
+    }
+
+
+    /// Integrate the function over all the elements of a model part, and write the integral over each element
+    /// to the variable of that element
+    TOutputType IntegrateOverModelPart(ModelPart& r_model_part, const int integration_order,
+            const Variable<TOutputType>& rVariable) const
+    {
+        return IntegrateElements(r_model_part.Elements(), integration_order, &rVariable, NULL);
+    }
+
+
+    /// Integrate the function over all the elements of the model part of the cache. The geometry data
+    /// of the integration method is computed and stored in the cache at the first call.
+    TOutputType IntegrateOverModelPart(IntegrationPointsCache& rCache, const int integration_order) const
+    {
+        InitializeCache(rCache, integration_order);
+        return IntegrateElements(rCache.GetModelPart().Elements(), integration_order, NULL, &rCache);
+    }
+
+
+    /// Integrate the function over all the elements of the model part of the cache, and write the integral
+    /// over each element to the variable of that element
+    TOutputType IntegrateOverModelPart(IntegrationPointsCache& rCache, const int integration_order,
+            const Variable<TOutputType>& rVariable) const
+    {
+        InitializeCache(rCache, integration_order);
+        return IntegrateElements(rCache.GetModelPart().Elements(), integration_order, &rVariable, &rCache);
+    }
+
+
     /// Helper function to compute determinant of Jacobian of a geometry at an integration point
     static double ComputeDetJ(GeometryType& r_geom,
             const GeometryType::IntegrationPointType& integration_point)
@@ -368,6 +673,123 @@ protected:
     ///@{
 
 
+    /// Integrate the function over a set of elements in parallel. The partial sum of each thread is kept separately
+    /// and the partial sums are added in a fixed order, so the result does not depend on the scheduling.
+    /// If pVariable is given, the integral over each element is written to the element.
+    /// If pCache is given, the geometry data at the integration points is taken from the cache at the position of the element,
+    /// the id is only searched if the element at that position in the cache is not the same.
+    TOutputType IntegrateElements(ModelPart::ElementsContainerType& rElements, const int integration_order,
+            const Variable<TOutputType>* pVariable, const IntegrationPointsCache* pCache) const
+    {
+        const GeometryData::IntegrationMethod ThisIntegrationMethod = GetIntegrationMethod(integration_order);
+
+        const int number_of_threads = OpenMPUtils::GetNumThreads();
+        OpenMPUtils::PartitionVector element_partition;
+        OpenMPUtils::DivideInPartitions(rElements.size(), number_of_threads, element_partition);
+
+        std::vector<TOutputType> PartialResults(number_of_threads, FunctionIntegrationTraits<TOutputType>::Zero());
+
+        #pragma omp parallel for
+        for(int k = 0; k < number_of_threads; ++k)
+        {
+            typename ModelPart::ElementsContainerType::iterator it_begin = rElements.begin() + element_partition[k];
+            typename ModelPart::ElementsContainerType::iterator it_end = rElements.begin() + element_partition[k+1];
+
+            TOutputType LocalResult = FunctionIntegrationTraits<TOutputType>::Zero();
+            std::size_t position = element_partition[k];
+            for(typename ModelPart::ElementsContainerType::iterator it = it_begin; it != it_end; ++it, ++position)
+            {
+                const InputType* Points = NULL;
+                const double* DetJ = NULL;
+                const double* Weights = NULL;
+                std::size_t n;
+                const TOutputType Value = (pCache == NULL) ?
+                        this->Integrate(it->GetGeometry(), ThisIntegrationMethod) :
+                        pCache->GetIntegrationPointsAt(position, it->Id(), ThisIntegrationMethod, Points, DetJ, Weights, n) ?
+                        this->IntegratePoints(Points, DetJ, Weights, n) :
+                        this->Integrate(*pCache, it->Id(), ThisIntegrationMethod);
+                if(pVariable != NULL)
+                    it->SetValue(*pVariable, Value);
+                FunctionIntegrationTraits<TOutputType>::AddTo(LocalResult, Value, 1.0);
+            }
+
+            PartialResults[k] = LocalResult;
+        }
+
+        TOutputType Result = FunctionIntegrationTraits<TOutputType>::Zero();
+        for(int k = 0; k < number_of_threads; ++k)
+            FunctionIntegrationTraits<TOutputType>::AddTo(Result, PartialResults[k], 1.0);
+
+        return Result;
+    }
+
+
+    /// Integrate the function given the global coordinates, determinants of Jacobian and weights of the integration points
+    TOutputType IntegratePoints(const InputType* Points, const double* DetJ, const double* Weights, const std::size_t n) const
+    {
+        KRATOS_THROW_ERROR(std::logic_error, "IntegratePoints is not implemented", "")
+    }
+
+
+    /// Compute the geometry data of the integration method in the cache if it is not there yet
+    static void InitializeCache(IntegrationPointsCache& rCache, const int integration_order)
+    {
+        const GeometryData::IntegrationMethod ThisIntegrationMethod = GetIntegrationMethod(integration_order);
+        if(!rCache.Has(ThisIntegrationMethod))
+            rCache.Initialize(ThisIntegrationMethod);
+    }
+
+
+    /// Return the instance of the simplified functions with the same key, or register the given function with this key.
+    /// The key shall identify the operation, its parameters and the (already shared) operands.
+    static Function::Pointer ShareFunction(SimplifyData& rData, const std::string& Key, const Function::Pointer& pFunction)
+    {
+        typename std::map<std::string, typename Function::Pointer>::iterator it = rData.Shared.find(Key);
+        if(it != rData.Shared.end())
+            return it->second;
+        rData.Shared[Key] = pFunction;
+        return pFunction;
+    }
+
+
+    /// Create the key of an operation for sharing of the sub-expressions
+    static std::string SimplifyKey(const std::string& Name, const Function* p1, const Function* p2, const double& a)
+    {
+        std::stringstream ss;
+        ss.precision(17);
+        ss << Name << "(" << p1 << "," << p2 << "," << a << ")";
+        return ss.str();
+    }
+
+
+    /// Compute the dual number of a scalar function from the symbolic derivative functions
+    DualType GetSymbolicDualValue(const TInputType& P) const
+    {
+        DualType Result(this->GetValue(P));
+        for(std::size_t i = 0; i < DualTraitsType::Dimension; ++i)
+        {
+            Function::Pointer pDerivative = this->GetCachedDiffFunction(i);
+            Result.Gradient(i) = pDerivative->GetValue(P);
+            for(std::size_t j = i; j < DualTraitsType::Dimension; ++j)
+            {
+                Result.Hessian(i, j) = pDerivative->GetCachedDiffFunction(j)->GetValue(P);
+                Result.Hessian(j, i) = Result.Hessian(i, j);
+            }
+        }
+        return Result;
+    }
+
+
+    /// Compute the first order dual number of a scalar function from the symbolic first derivative functions
+    GradientDualType GetSymbolicGradientDualValue(const TInputType& P) const
+    {
+        GradientDualType Result(this->GetValue(P));
+        for(std::size_t i = 0; i < DualTraitsType::Dimension; ++i)
+            Result.Gradient(i) = this->GetCachedDiffFunction(i)->GetValue(P);
+        return Result;
+    }
+
+
     ///@}
     ///@name Protected  Access
     ///@{
@@ -394,6 +816,10 @@ private:
     ///@name Member Variables
     ///@{
 
+    /// The cache of derivative functions is not copied, i.e. a cloned function starts with an empty cache
+    mutable Function::Pointer mpDiffFunctions[MaxNumberOfComponents];
+    mutable std::atomic<bool> mIsDiffFunctionSet[MaxNumberOfComponents];
+    mutable std::mutex mDiffFunctionsMutex;
 
     ///@}
     ///@name Private Operators
@@ -404,6 +830,12 @@ private:
     ///@name Private Operations
     ///@{
 
+    void InitializeDiffFunctions()
+    {
+        for(std::size_t i = 0; i < MaxNumberOfComponents; ++i)
+            mIsDiffFunctionSet[i].store(false, std::memory_order_relaxed);
+    }
+
     friend class Serializer;
 
     virtual void save(Serializer& rSerializer) const
@@ -435,6 +867,9 @@ private:
 
 }; // Class Function
 
+template<typename TInputType, typename TOutputType>
+const std::size_t Function<TInputType, TOutputType>::MaxNumberOfComponents;
+
 ///@}
 
 ///@name Type Definitions
@@ -469,30 +904,175 @@ template<> inline const std::size_t FunctionR2R3::OutputSize() const {return 3;}
 template<> inline const std::size_t FunctionR2R1::InputSize() const {return 2;}
 template<> inline const std::size_t FunctionR2R1::OutputSize() const {return 1;}
 
+/// The single derivatives are extracted from the dual number only if the function propagates it, otherwise
+/// computing the dual number would evaluate all the derivative functions to return one of them
+template<typename TFunction>
+inline double Function_GetDualDerivative(const TFunction& rFunction, const int& component, const typename TFunction::InputType& P)
+{
+    if(rFunction.HasDualValue())
+        return rFunction.GetGradientDualValue(P).Gradient(component);
+    return rFunction.GetCachedDiffFunction(component)->GetValue(P);
+}
 
-template<>
-inline double FunctionR3R1::Integrate(GeometryType& r_geom,
-        const GeometryData::IntegrationMethod ThisIntegrationMethod) const
+template<typename TFunction>
+inline double Function_GetDualSecondDerivative(const TFunction& rFunction, const int& component_1, const int& component_2,
+        const typename TFunction::InputType& P)
 {
-    const GeometryType::IntegrationPointsArrayType& integration_points
-            = r_geom.IntegrationPoints( ThisIntegrationMethod );
+    if(rFunction.HasDualValue())
+        return rFunction.GetDualValue(P).Hessian(component_1, component_2);
+    return rFunction.GetCachedDiffFunction(component_1)->GetCachedDiffFunction(component_2)->GetValue(P);
+}
+
+/// For the scalar functions without a dual propagation, the dual number is computed from the symbolic derivative functions
+template<> inline FunctionR1R1::DualType FunctionR1R1::GetDualValue(const InputType& P) const {return GetSymbolicDualValue(P);}
+template<> inline FunctionR2R1::DualType FunctionR2R1::GetDualValue(const InputType& P) const {return GetSymbolicDualValue(P);}
+template<> inline FunctionR3R1::DualType FunctionR3R1::GetDualValue(const InputType& P) const {return GetSymbolicDualValue(P);}
+
+template<> inline FunctionR1R1::GradientDualType FunctionR1R1::GetGradientDualValue(const InputType& P) const {return GetSymbolicGradientDualValue(P);}
+template<> inline FunctionR2R1::GradientDualType FunctionR2R1::GetGradientDualValue(const InputType& P) const {return GetSymbolicGradientDualValue(P);}
+template<> inline FunctionR3R1::GradientDualType FunctionR3R1::GetGradientDualValue(const InputType& P) const {return GetSymbolicGradientDualValue(P);}
 
-    double Result = 0.0;
+template<> inline double FunctionR1R1::GetDerivative(const int& component, const InputType& P) const {return Function_GetDualDerivative(*this, component, P);}
+template<> inline double FunctionR2R1::GetDerivative(const int& component, const InputType& P) const {return Function_GetDualDerivative(*this, component, P);}
+template<> inline double FunctionR3R1::GetDerivative(const int& component, const InputType& P) const {return Function_GetDualDerivative(*this, component, P);}
 
-    std::vector<double> DetJ;
-    ComputeDetJ(DetJ, r_geom, integration_points);
+template<> inline double FunctionR1R1::GetSecondDerivative(const int& component_1, const int& component_2, const InputType& P) const {return Function_GetDualSecondDerivative(*this, component_1, component_2, P);}
+template<> inline double FunctionR2R1::GetSecondDerivative(const int& component_1, const int& component_2, const InputType& P) const {return Function_GetDualSecondDerivative(*this, component_1, component_2, P);}
+template<> inline double FunctionR3R1::GetSecondDerivative(const int& component_1, const int& component_2, const InputType& P) const {return Function_GetDualSecondDerivative(*this, component_1, component_2, P);}
 
-    CoordinatesArrayType GlobalCoords;
+/// The gradient is taken from the first order dual number, which does not compute the Hessian. For the functions
+/// without a dual propagation, only the first derivative functions are evaluated.
+template<typename TFunction>
+inline void Function_GetDualGradient(const TFunction& rFunction, const typename TFunction::InputType& P,
+        typename TFunction::GradientType& rGradient)
+{
+    typedef typename TFunction::GradientDualType GradientDualType;
 
-    for(std::size_t point = 0; point < integration_points.size(); ++point)
+    if(!rFunction.HasDualValue())
     {
-        r_geom.GlobalCoordinates(GlobalCoords, integration_points[point]);
-        Result += GetValue(GlobalCoords) * DetJ[point] * integration_points[point].Weight();
+        for(std::size_t i = 0; i < GradientDualType::Dimension(); ++i)
+            rGradient[i] = rFunction.GetCachedDiffFunction(i)->GetValue(P);
+        return;
     }
 
+    const GradientDualType D = rFunction.GetGradientDualValue(P);
+    for(std::size_t i = 0; i < D.Dimension(); ++i)
+        rGradient[i] = D.Gradient(i);
+}
+
+template<typename TFunction>
+inline void Function_GetDualHessian(const TFunction& rFunction, const typename TFunction::InputType& P,
+        typename TFunction::HessianType& rHessian)
+{
+    const typename TFunction::DualType D = rFunction.GetDualValue(P);
+    for(std::size_t i = 0; i < D.Dimension(); ++i)
+        for(std::size_t j = 0; j < D.Dimension(); ++j)
+            rHessian(i, j) = D.Hessian(i, j);
+}
+
+/// Adapter of the fixed-size gradient of a scalar function to a heap vector
+template<typename TFunction>
+inline Vector Function_GetHeapGradient(const TFunction& rFunction, const typename TFunction::InputType& P)
+{
+    typename TFunction::GradientType G;
+    rFunction.GetGradient(P, G);
+    return G;
+}
+
+/// Adapter of the fixed-size Hessian of a scalar function to a heap matrix
+template<typename TFunction>
+inline Matrix Function_GetHeapHessian(const TFunction& rFunction, const typename TFunction::InputType& P)
+{
+    typename TFunction::HessianType H;
+    rFunction.GetHessian(P, H);
+    return H;
+}
+
+template<> inline void FunctionR1R1::GetGradient(const InputType& P, GradientType& rGradient) const {Function_GetDualGradient(*this, P, rGradient);}
+template<> inline void FunctionR2R1::GetGradient(const InputType& P, GradientType& rGradient) const {Function_GetDualGradient(*this, P, rGradient);}
+template<> inline void FunctionR3R1::GetGradient(const InputType& P, GradientType& rGradient) const {Function_GetDualGradient(*this, P, rGradient);}
+
+template<> inline void FunctionR1R1::GetHessian(const InputType& P, HessianType& rHessian) const {Function_GetDualHessian(*this, P, rHessian);}
+template<> inline void FunctionR2R1::GetHessian(const InputType& P, HessianType& rHessian) const {Function_GetDualHessian(*this, P, rHessian);}
+template<> inline void FunctionR3R1::GetHessian(const InputType& P, HessianType& rHessian) const {Function_GetDualHessian(*this, P, rHessian);}
+
+template<> inline Vector FunctionR1R1::GetGradient(const InputType& P) const {return Function_GetHeapGradient(*this, P);}
+template<> inline Vector FunctionR2R1::GetGradient(const InputType& P) const {return Function_GetHeapGradient(*this, P);}
+template<> inline Vector FunctionR3R1::GetGradient(const InputType& P) const {return Function_GetHeapGradient(*this, P);}
+
+template<> inline Matrix FunctionR1R1::GetHessian(const InputType& P) const {return Function_GetHeapHessian(*this, P);}
+template<> inline Matrix FunctionR2R1::GetHessian(const InputType& P) const {return Function_GetHeapHessian(*this, P);}
+template<> inline Matrix FunctionR3R1::GetHessian(const InputType& P) const {return Function_GetHeapHessian(*this, P);}
+
+
+/// Integrate a function on R^3 at a set of points. The function is evaluated at all the points in one batch
+/// and all the components of the output are accumulated in the same sweep.
+template<typename TFunction>
+inline typename TFunction::OutputType Function_IntegratePoints(const TFunction& rFunction,
+        const typename TFunction::InputType* Points, const double* DetJ, const double* Weights, const std::size_t n)
+{
+    typedef typename TFunction::OutputType OutputType;
+    typedef FunctionIntegrationTraits<OutputType> TraitsType;
+
+    OutputType Result = TraitsType::Zero();
+    if(n == 0)
+        return Result;
+
+    std::vector<OutputType> Values(n);
+    rFunction.GetValues(Points, n, &Values[0]);
+
+    for(std::size_t point = 0; point < n; ++point)
+        TraitsType::AddTo(Result, Values[point], DetJ[point] * Weights[point]);
+
     return Result;
 }
 
+/// Integrate a function on R^3 over a geometry. The global coordinates and the determinant of Jacobian
+/// are computed once per integration point, whatever the number of components of the function is.
+template<typename TFunction>
+inline typename TFunction::OutputType Function_IntegrateGeometry(const TFunction& rFunction,
+        typename TFunction::GeometryType& r_geom, const GeometryData::IntegrationMethod ThisIntegrationMethod)
+{
+    const std::size_t n = r_geom.IntegrationPoints( ThisIntegrationMethod ).size();
+    if(n == 0)
+        return FunctionIntegrationTraits<typename TFunction::OutputType>::Zero();
+
+    std::vector<typename TFunction::InputType> GlobalCoords(n);
+    std::vector<double> DetJ(n);
+    std::vector<double> Weights(n);
+    Matrix J, JtJ;
+    IntegrationPointsCache::ComputeGeometryData(r_geom, ThisIntegrationMethod, &GlobalCoords[0], &DetJ[0], &Weights[0], J, JtJ);
+
+    return Function_IntegratePoints(rFunction, &GlobalCoords[0], &DetJ[0], &Weights[0], n);
+}
+
+/// Integrate a function on R^3 over an element using the geometry data stored in the cache
+template<typename TFunction>
+inline typename TFunction::OutputType Function_IntegrateCache(const TFunction& rFunction,
+        const IntegrationPointsCache& rCache, const std::size_t& ElementId, const GeometryData::IntegrationMethod ThisIntegrationMethod)
+{
+    const typename TFunction::InputType* Points = NULL;
+    const double* DetJ = NULL;
+    const double* Weights = NULL;
+    std::size_t n;
+    if(!rCache.GetIntegrationPoints(ElementId, ThisIntegrationMethod, Points, DetJ, Weights, n))
+        KRATOS_THROW_ERROR(std::logic_error, "The integration points are not in the cache for element", ElementId)
+
+    return Function_IntegratePoints(rFunction, Points, DetJ, Weights, n);
+}
+
+template<> inline double FunctionR3R1::IntegratePoints(const InputType* Points, const double* DetJ, const double* Weights, const std::size_t n) const {return Function_IntegratePoints(*this, Points, DetJ, Weights, n);}
+template<> inline array_1d<double, 3> FunctionR3R3::IntegratePoints(const InputType* Points, const double* DetJ, const double* Weights, const std::size_t n) const {return Function_IntegratePoints(*this, Points, DetJ, Weights, n);}
+template<> inline Vector FunctionR3Rn::IntegratePoints(const InputType* Points, const double* DetJ, const double* Weights, const std::size_t n) const {return Function_IntegratePoints(*this, Points, DetJ, Weights, n);}
+
+template<> inline double FunctionR3R1::Integrate(GeometryType& r_geom, const GeometryData::IntegrationMethod ThisIntegrationMethod) const {return Function_IntegrateGeometry(*this, r_geom, ThisIntegrationMethod);}
+template<> inline array_1d<double, 3> FunctionR3R3::Integrate(GeometryType& r_geom, const GeometryData::IntegrationMethod ThisIntegrationMethod) const {return Function_IntegrateGeometry(*this, r_geom, ThisIntegrationMethod);}
+template<> inline Vector FunctionR3Rn::Integrate(GeometryType& r_geom, const GeometryData::IntegrationMethod ThisIntegrationMethod) const {return Function_IntegrateGeometry(*this, r_geom, ThisIntegrationMethod);}
+
+template<> inline double FunctionR3R1::Integrate(const IntegrationPointsCache& rCache, const std::size_t& ElementId, const GeometryData::IntegrationMethod ThisIntegrationMethod) const {return Function_IntegrateCache(*this, rCache, ElementId, ThisIntegrationMethod);}
+template<> inline array_1d<double, 3> FunctionR3R3::Integrate(const IntegrationPointsCache& rCache, const std::size_t& ElementId, const GeometryData::IntegrationMethod ThisIntegrationMethod) const {return Function_IntegrateCache(*this, rCache, ElementId, ThisIntegrationMethod);}
+template<> inline Vector FunctionR3Rn::Integrate(const IntegrationPointsCache& rCache, const std::size_t& ElementId, const GeometryData::IntegrationMethod ThisIntegrationMethod) const {return Function_IntegrateCache(*this, rCache, ElementId, ThisIntegrationMethod);}
+
 
 ///@}
 ///@name Input and output
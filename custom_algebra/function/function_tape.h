@@ -0,0 +1,577 @@
+//    |  /           |
+//    ' /   __| _` | __|  _ \   __|
+//    . \  |   (   | |   (   |\__ `
+//   _|\_\_|  \__,_|\__|\___/ ____/
+//                   Multi-Physics
+//
+//  License:         brep_application/LICENSE.txt
+//                   Kratos default license: kratos/license.txt
+//
+//  Main authors:    Hoang-Giang Bui
+//  Date:            16 Oct 2026
+//
+
+
+#if !defined(KRATOS_FUNCTION_TAPE_H_INCLUDED )
+#define  KRATOS_FUNCTION_TAPE_H_INCLUDED
+
+
+
+// System includes
+#include <map>
+#include <cmath>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <algorithm>
+
+
+// External includes
+#include <boost/tuple/tuple.hpp>
+#include <boost/tuple/tuple_comparison.hpp>
+
+
+// Project includes
+#include "includes/define.h"
+#include "containers/array_1d.h"
+
+
+namespace Kratos
+{
+///@addtogroup BRepApplication
+///@{
+
+///@name Kratos Globals
+///@{
+
+template<typename TInputType, typename TOutputType> class Function;
+
+///@}
+///@name Type Definitions
+///@{
+
+///@}
+///@name  Enum's
+///@{
+
+///@}
+///@name  Functions
+///@{
+
+///@}
+///@name Kratos Classes
+///@{
+
+/// Short class definition.
+/** Flat, register based evaluation tape for a scalar function.
+ * Each instruction writes its result to the register with the same index, hence the tape is in SSA form. The tape is filled
+ * by Function::Compile, which walks the function tree once and returns the register holding the value of the function.
+ * Because of the sharing and folding below, this register is not necessarily the last one and must be passed to the evaluation.
+ * Nodes which do not provide Compile are kept as an opaque call to Function::GetValue(s).
+ * Identical instructions are emitted only once and instructions with constant operands are folded while emitting.
+ */
+template<typename TInputType, typename TOutputType>
+class FunctionTape
+{
+public:
+    ///@name Type Definitions
+    ///@{
+
+    /// Pointer definition of FunctionTape
+    KRATOS_CLASS_POINTER_DEFINITION(FunctionTape);
+
+    typedef Function<TInputType, TOutputType> FunctionType;
+
+    enum OpCode
+    {
+        CONSTANT,
+        VARIABLE,
+        ADD,
+        SUBTRACT,
+        MULTIPLY,
+        DIVIDE,
+        MIN,
+        MAX,
+        NEGATE,
+        SCALE,
+        INVERSE,
+        SQUARE,
+        SQRT,
+        POW,
+        INTEGER_POW,
+        COS,
+        SIN,
+        ACOS,
+        CALL
+    };
+
+    struct Instruction
+    {
+        OpCode Op;
+        std::size_t Arg1;
+        std::size_t Arg2;
+        double Value;
+        const FunctionType* pFunction;
+    };
+
+    /// number of points evaluated at once in the batched mode
+    static const std::size_t BatchSize = 64;
+
+    /// number of registers which are kept on the stack for a single point evaluation
+    static const std::size_t MaxStackRegisters = 128;
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// Default constructor.
+    FunctionTape()
+    {}
+
+    /// Destructor.
+    virtual ~FunctionTape()
+    {}
+
+
+    ///@}
+    ///@name Operators
+    ///@{
+
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+
+    /// Remove all instructions
+    void Clear()
+    {
+        mInstructions.clear();
+        mInstructionIndex.clear();
+    }
+
+
+    /// Emit a constant
+    std::size_t AddConstant(const double& value)
+    {
+        return this->Emit(CONSTANT, 0, 0, value, NULL);
+    }
+
+
+    /// Emit the component of the input point. The component index is stored as the parameter of the instruction.
+    std::size_t AddVariable(const std::size_t& component)
+    {
+        return this->Emit(VARIABLE, 0, 0, static_cast<double>(component), NULL);
+    }
+
+
+    /// Emit an unary operation on register a. value is the parameter of SCALE, POW and INTEGER_POW.
+    std::size_t AddUnary(const OpCode& op, const std::size_t& a, const double& value = 0.0)
+    {
+        if(mInstructions[a].Op == CONSTANT)
+            return this->AddConstant(Apply(op, mInstructions[a].Value, 0.0, value));
+
+        if((op == SCALE) && (value == 1.0))
+            return a;
+        if(((op == POW) || (op == INTEGER_POW)) && (value == 1.0))
+            return a;
+        if((op == INTEGER_POW) && (value == 2.0))
+            return this->Emit(SQUARE, a, 0, 0.0, NULL);
+
+        return this->Emit(op, a, 0, value, NULL);
+    }
+
+
+    /// Emit a binary operation on registers a and b
+    std::size_t AddBinary(const OpCode& op, const std::size_t& a, const std::size_t& b)
+    {
+        if((mInstructions[a].Op == CONSTANT) && (mInstructions[b].Op == CONSTANT))
+            return this->AddConstant(Apply(op, mInstructions[a].Value, mInstructions[b].Value, 0.0));
+
+        // commutative operations are stored with ordered operands to increase the chance of sharing
+        if((op == ADD || op == MULTIPLY || op == MIN || op == MAX) && (a > b))
+            return this->Emit(op, b, a, 0.0, NULL);
+
+        return this->Emit(op, a, b, 0.0, NULL);
+    }
+
+
+    /// Emit an opaque call to a function which can't be compiled
+    std::size_t AddCall(const FunctionType* pFunction)
+    {
+        return this->Emit(CALL, 0, 0, 0.0, pFunction);
+    }
+
+
+    /// Emit the monomial x_0^Degrees[0] * ... * x_{dim-1}^Degrees[dim-1]
+    std::size_t AddMonomial(const std::size_t* Degrees, const std::size_t& dim)
+    {
+        bool trail = false;
+        std::size_t result = 0;
+        for(std::size_t i = 0; i < dim; ++i)
+        {
+            if(Degrees[i] == 0)
+                continue;
+
+            std::size_t term = this->AddUnary(INTEGER_POW, this->AddVariable(i), static_cast<double>(Degrees[i]));
+            if(trail)
+                result = this->AddBinary(MULTIPLY, result, term);
+            else
+                result = term;
+            trail = true;
+        }
+
+        if(!trail)
+            result = this->AddConstant(1.0);
+
+        return result;
+    }
+
+
+    /// Evaluate the register Output of the tape at a point
+    double GetValue(const TInputType& P, const std::size_t& Output) const
+    {
+        if(Output < MaxStackRegisters)
+        {
+            double Registers[MaxStackRegisters];
+            return this->Execute(P, Output, Registers);
+        }
+
+        std::vector<double> Registers(Output + 1);
+        return this->Execute(P, Output, &Registers[0]);
+    }
+
+
+    /// Evaluate the register Output of the tape at a batch of points. The instructions are executed one after another on
+    /// blocks of BatchSize points. The instructions after Output do not contribute to it and are skipped.
+    void GetValues(const TInputType* P, const std::size_t n, double* Values, const std::size_t& Output) const
+    {
+        if(Output >= mInstructions.size())
+            KRATOS_THROW_ERROR(std::logic_error, "The output register is not in the tape, size =", mInstructions.size())
+
+        const std::size_t nreg = Output + 1;
+        std::vector<double> Registers(nreg * BatchSize);
+
+        for(std::size_t begin = 0; begin < n; begin += BatchSize)
+        {
+            const std::size_t m = std::min(BatchSize, n - begin);
+            const TInputType* Q = P + begin;
+
+            for(std::size_t i = 0; i < nreg; ++i)
+            {
+                const Instruction& rI = mInstructions[i];
+                double* r = &Registers[i * BatchSize];
+                const double* a = &Registers[rI.Arg1 * BatchSize];
+                const double* b = &Registers[rI.Arg2 * BatchSize];
+
+                switch(rI.Op)
+                {
+                case CONSTANT:
+                    std::fill(r, r + m, rI.Value);
+                    break;
+                case VARIABLE:
+                    for(std::size_t j = 0; j < m; ++j) r[j] = Component(Q[j], static_cast<std::size_t>(rI.Value));
+                    break;
+                case ADD:
+                    for(std::size_t j = 0; j < m; ++j) r[j] = a[j] + b[j];
+                    break;
+                case SUBTRACT:
+                    for(std::size_t j = 0; j < m; ++j) r[j] = a[j] - b[j];
+                    break;
+                case MULTIPLY:
+                    for(std::size_t j = 0; j < m; ++j) r[j] = a[j] * b[j];
+                    break;
+                case DIVIDE:
+                    for(std::size_t j = 0; j < m; ++j) r[j] = a[j] / b[j];
+                    break;
+                case MIN:
+                    for(std::size_t j = 0; j < m; ++j) r[j] = std::min(a[j], b[j]);
+                    break;
+                case MAX:
+                    for(std::size_t j = 0; j < m; ++j) r[j] = std::max(a[j], b[j]);
+                    break;
+                case NEGATE:
+                    for(std::size_t j = 0; j < m; ++j) r[j] = -a[j];
+                    break;
+                case SCALE:
+                    for(std::size_t j = 0; j < m; ++j) r[j] = rI.Value * a[j];
+                    break;
+                case INVERSE:
+                    for(std::size_t j = 0; j < m; ++j) r[j] = 1.0 / a[j];
+                    break;
+                case SQUARE:
+                    for(std::size_t j = 0; j < m; ++j) r[j] = a[j] * a[j];
+                    break;
+                case CALL:
+                    rI.pFunction->GetValues(Q, m, r);
+                    break;
+                default:
+                    for(std::size_t j = 0; j < m; ++j) r[j] = Apply(rI.Op, a[j], b[j], rI.Value);
+                }
+            }
+
+            std::copy(&Registers[Output * BatchSize], &Registers[Output * BatchSize] + m, Values + begin);
+        }
+    }
+
+
+    ///@}
+    ///@name Access
+    ///@{
+
+
+    const std::vector<Instruction>& Instructions() const
+    {
+        return mInstructions;
+    }
+
+
+    ///@}
+    ///@name Inquiry
+    ///@{
+
+
+    /// Number of instructions, which is also the number of registers
+    std::size_t Size() const
+    {
+        return mInstructions.size();
+    }
+
+
+    /// Number of opaque calls in the tape
+    std::size_t NumberOfCalls() const
+    {
+        std::size_t cnt = 0;
+        for(std::size_t i = 0; i < mInstructions.size(); ++i)
+            if(mInstructions[i].Op == CALL)
+                ++cnt;
+        return cnt;
+    }
+
+
+    ///@}
+    ///@name Input and output
+    ///@{
+
+    /// Turn back information as a string.
+    virtual std::string Info() const
+    {
+        return "Function Tape";
+    }
+
+    /// Print information about this object.
+    virtual void PrintInfo(std::ostream& rOStream) const
+    {
+        rOStream << Info();
+    }
+
+    /// Print object's data.
+    virtual void PrintData(std::ostream& rOStream) const
+    {
+        for(std::size_t i = 0; i < mInstructions.size(); ++i)
+        {
+            const Instruction& rI = mInstructions[i];
+            rOStream << "r" << i << " = " << OpName(rI.Op);
+            if(rI.Op == CONSTANT)
+                rOStream << " " << rI.Value;
+            else if(rI.Op == VARIABLE)
+                rOStream << " x" << rI.Value;
+            else if(rI.Op == CALL)
+                rOStream << " " << rI.pFunction->Info();
+            else
+            {
+                rOStream << " r" << rI.Arg1;
+                if(IsBinary(rI.Op))
+                    rOStream << " r" << rI.Arg2;
+                if(rI.Op == SCALE || rI.Op == POW || rI.Op == INTEGER_POW)
+                    rOStream << " " << rI.Value;
+            }
+            rOStream << std::endl;
+        }
+    }
+
+
+    ///@}
+
+private:
+    ///@name Member Variables
+    ///@{
+
+    std::vector<Instruction> mInstructions;
+
+    std::map<boost::tuple<int, std::size_t, std::size_t, double, const FunctionType*>, std::size_t> mInstructionIndex;
+
+    ///@}
+    ///@name Private Operations
+    ///@{
+
+
+    std::size_t Emit(const OpCode& op, const std::size_t& a, const std::size_t& b, const double& value, const FunctionType* pFunction)
+    {
+        boost::tuple<int, std::size_t, std::size_t, double, const FunctionType*> key(op, a, b, value, pFunction);
+        typename std::map<boost::tuple<int, std::size_t, std::size_t, double, const FunctionType*>, std::size_t>::iterator it = mInstructionIndex.find(key);
+        if(it != mInstructionIndex.end())
+            return it->second;
+
+        Instruction I;
+        I.Op = op;
+        I.Arg1 = a;
+        I.Arg2 = b;
+        I.Value = value;
+        I.pFunction = pFunction;
+        mInstructions.push_back(I);
+
+        std::size_t index = mInstructions.size() - 1;
+        mInstructionIndex[key] = index;
+        return index;
+    }
+
+
+    double Execute(const TInputType& P, const std::size_t& Output, double* Registers) const
+    {
+        if(Output >= mInstructions.size())
+            KRATOS_THROW_ERROR(std::logic_error, "The output register is not in the tape, size =", mInstructions.size())
+
+        for(std::size_t i = 0; i <= Output; ++i)
+        {
+            const Instruction& rI = mInstructions[i];
+            switch(rI.Op)
+            {
+            case CONSTANT:
+                Registers[i] = rI.Value;
+                break;
+            case VARIABLE:
+                Registers[i] = Component(P, static_cast<std::size_t>(rI.Value));
+                break;
+            case CALL:
+                Registers[i] = rI.pFunction->GetValue(P);
+                break;
+            default:
+                Registers[i] = Apply(rI.Op, Registers[rI.Arg1], Registers[rI.Arg2], rI.Value);
+            }
+        }
+
+        return Registers[Output];
+    }
+
+
+    static inline double Apply(const OpCode& op, const double& a, const double& b, const double& value)
+    {
+        switch(op)
+        {
+        case ADD:           return a + b;
+        case SUBTRACT:      return a - b;
+        case MULTIPLY:      return a * b;
+        case DIVIDE:        return a / b;
+        case MIN:           return std::min(a, b);
+        case MAX:           return std::max(a, b);
+        case NEGATE:        return -a;
+        case SCALE:         return value * a;
+        case INVERSE:       return 1.0 / a;
+        case SQUARE:        return a * a;
+        case SQRT:          return std::sqrt(a);
+        case POW:           return std::pow(a, value);
+        case INTEGER_POW:   return IntegerPow(a, static_cast<int>(value));
+        case COS:           return std::cos(a);
+        case SIN:           return std::sin(a);
+        case ACOS:          return std::acos(a);
+        default:
+            KRATOS_THROW_ERROR(std::logic_error, "Unknown operation", static_cast<int>(op))
+        }
+    }
+
+
+    static inline double IntegerPow(double a, int n)
+    {
+        double result = 1.0;
+        while(n > 0)
+        {
+            if(n & 1)
+                result *= a;
+            a *= a;
+            n >>= 1;
+        }
+        return result;
+    }
+
+
+    static inline double Component(const double& P, const std::size_t& i)
+    {
+        return P;
+    }
+
+
+    template<std::size_t TDimension>
+    static inline double Component(const array_1d<double, TDimension>& P, const std::size_t& i)
+    {
+        return P[i];
+    }
+
+
+    static bool IsBinary(const OpCode& op)
+    {
+        return (op == ADD) || (op == SUBTRACT) || (op == MULTIPLY) || (op == DIVIDE) || (op == MIN) || (op == MAX);
+    }
+
+
+    static std::string OpName(const OpCode& op)
+    {
+        switch(op)
+        {
+        case CONSTANT:      return "const";
+        case VARIABLE:      return "var";
+        case ADD:           return "add";
+        case SUBTRACT:      return "sub";
+        case MULTIPLY:      return "mul";
+        case DIVIDE:        return "div";
+        case MIN:           return "min";
+        case MAX:           return "max";
+        case NEGATE:        return "neg";
+        case SCALE:         return "scale";
+        case INVERSE:       return "inv";
+        case SQUARE:        return "sqr";
+        case SQRT:          return "sqrt";
+        case POW:           return "pow";
+        case INTEGER_POW:   return "ipow";
+        case COS:           return "cos";
+        case SIN:           return "sin";
+        case ACOS:          return "acos";
+        case CALL:          return "call";
+        }
+        return "unknown";
+    }
+
+
+    ///@}
+
+}; // Class FunctionTape
+
+template<typename TInputType, typename TOutputType>
+const std::size_t FunctionTape<TInputType, TOutputType>::BatchSize;
+
+template<typename TInputType, typename TOutputType>
+const std::size_t FunctionTape<TInputType, TOutputType>::MaxStackRegisters;
+
+///@}
+
+///@name Input and output
+///@{
+
+
+/// output stream function
+template<typename TInputType, typename TOutputType>
+inline std::ostream& operator << (std::ostream& rOStream, const FunctionTape<TInputType, TOutputType>& rThis)
+{
+    rThis.PrintInfo(rOStream);
+    rOStream << std::endl;
+    rThis.PrintData(rOStream);
+
+    return rOStream;
+}
+///@}
+
+///@} addtogroup block
+
+}  // namespace Kratos.
+
+#endif // KRATOS_FUNCTION_TAPE_H_INCLUDED  defined
@@ -30,6 +30,7 @@
 #include "custom_algebra/function/function.h"
 #include "custom_algebra/function/zero_function.h"
 #include "custom_algebra/brep.h"
+#include "custom_algebra/level_set/level_set.h"
 
 
 namespace Kratos
@@ -81,16 +82,20 @@ public:
 
     /// Default constructor.
     HeavisideFunction(const BRep& r_brep)
-    : BaseType(), mr_brep(r_brep)
+    : BaseType(), mpr_brep(&r_brep)
     {}
 
     HeavisideFunction(const BRep::Pointer p_brep)
-    : BaseType(), mr_brep(*p_brep)
+    : BaseType(), mp_brep(p_brep), mpr_brep(p_brep.get())
+    {}
+
+    /// Default constructor, only used by the serializer.
+    HeavisideFunction() : BaseType(), mpr_brep(NULL)
     {}
 
     /// Copy constructor.
     HeavisideFunction(HeavisideFunction const& rOther)
-    : BaseType(rOther), mr_brep(rOther.mr_brep)
+    : BaseType(rOther), mp_brep(rOther.mp_brep), mpr_brep(rOther.mpr_brep)
     {}
 
     /// Destructor.
@@ -116,13 +121,31 @@ public:
 
     virtual double GetValue(const InputType& P) const
     {
-        if(mr_brep.IsInside(P))
+        if(mpr_brep->IsInside(P))
             return 1.0;
         else
             return 0.0;
     }
 
 
+    virtual typename BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        return typename BaseType::DualType(this->GetValue(P));
+    }
+
+
+    virtual typename BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        return typename BaseType::GradientDualType(this->GetValue(P));
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return "H(L)";
@@ -220,7 +243,9 @@ private:
     ///@name Member Variables
     ///@{
 
-    const BRep& mr_brep;
+    BRep::Pointer mp_brep; // null if the function is given the BRep by reference
+    LevelSet::Pointer mp_level_set; // the BRep if it is a level set, as loaded by the serializer
+    const BRep* mpr_brep;
 
     ///@}
     ///@name Private Operators
@@ -231,6 +256,23 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        if(mp_brep.get() == NULL)
+            KRATOS_THROW_ERROR(std::logic_error, "The Heaviside function given the BRep by reference can't be serialized", "")
+
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        LevelSet::SaveBRep(rSerializer, "BRep", mp_brep);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        LevelSet::LoadBRep(rSerializer, "BRep", mp_brep, mp_level_set);
+        mpr_brep = mp_brep.get();
+    }
 
     ///@}
     ///@name Private  Access
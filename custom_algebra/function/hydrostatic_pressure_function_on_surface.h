@@ -95,9 +95,13 @@ public:
     //         KRATOS_THROW_ERROR(std::logic_error, "The normal vector must have at least 3 components", "")
     // }
 
+    /// Default constructor, only used by the serializer.
+    HydrostaticPressureFunctionOnSurface() : BaseType(), mPressure(0.0), mGradientPressure(0.0)
+    {}
+
     /// Copy constructor.
     HydrostaticPressureFunctionOnSurface(HydrostaticPressureFunctionOnSurface const& rOther)
-    : BaseType(rOther), mPressure(rOther.mPressure), mGradientPressure(mGradientPressure), mNormal(rOther.mNormal)
+    : BaseType(rOther), mPressure(rOther.mPressure), mGradientPressure(rOther.mGradientPressure), mNormal(rOther.mNormal)
     {}
 
     /// Destructor.
@@ -274,6 +278,23 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("Pressure", mPressure);
+        rSerializer.save("GradientPressure", mGradientPressure);
+        rSerializer.save("Normal", mNormal);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("Pressure", mPressure);
+        rSerializer.load("GradientPressure", mGradientPressure);
+        rSerializer.load("Normal", mNormal);
+    }
 
     ///@}
     ///@name Private  Access
@@ -28,6 +28,7 @@
 // Project includes
 #include "includes/define.h"
 #include "custom_algebra/function/function.h"
+#include "custom_algebra/function/scalar_function.h"
 
 
 namespace Kratos
@@ -83,6 +84,10 @@ public:
     : BaseType(), mp_func(p_func)
     {}
 
+    /// Default constructor, only used by the serializer.
+    InverseFunction() : BaseType()
+    {}
+
     /// Copy constructor.
     InverseFunction(InverseFunction const& rOther)
     : BaseType(rOther), mp_func(rOther.mp_func->CloneFunction())
@@ -115,6 +120,55 @@ public:
     }
 
 
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        mp_func->GetValues(P, n, Values);
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = 1.0/Values[i];
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        return rTape.AddUnary(FunctionTape<InputType, OutputType>::INVERSE, mp_func->Compile(rTape));
+    }
+
+
+    virtual typename BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        return 1.0/mp_func->GetDualValue(P);
+    }
+
+
+    virtual typename BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        return 1.0/mp_func->GetGradientDualValue(P);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return mp_func->HasDualValue();
+    }
+
+
+    virtual typename BaseType::Pointer SimplifyFunction(typename BaseType::SimplifyData& rData) const
+    {
+        typename BaseType::Pointer p = mp_func->Simplify(rData);
+
+        OutputType v;
+        if(p->IsConstant(v))
+            return ConstantFunctionFactory<BaseType>::Create(rData, 1.0/v);
+
+        const InverseFunction* pInverse = dynamic_cast<const InverseFunction*>(p.get());
+        if(pInverse != NULL)
+            return pInverse->mp_func->Simplify(rData);
+
+        return BaseType::ShareFunction(rData, BaseType::SimplifyKey("Inverse", p.get(), NULL, 0.0),
+                typename BaseType::Pointer(new InverseFunction(p)));
+    }
+
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         std::stringstream ss;
@@ -225,7 +279,7 @@ private:
     ///@name Member Variables
     ///@{
 
-    const typename BaseType::Pointer mp_func;
+    typename BaseType::Pointer mp_func;
 
     ///@}
     ///@name Private Operators
@@ -236,6 +290,19 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("Function", mp_func);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("Function", mp_func);
+    }
 
     ///@}
     ///@name Private  Access
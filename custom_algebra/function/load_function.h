@@ -19,8 +19,10 @@
 
 // System includes
 #include <string>
+#include <vector>
 #include <sstream>
 #include <iostream>
+#include <algorithm>
 
 
 // External includes
@@ -29,6 +31,7 @@
 // Project includes
 #include "includes/define.h"
 #include "custom_algebra/function/function.h"
+#include "custom_algebra/function/zero_function.h"
 
 
 namespace Kratos
@@ -55,6 +58,35 @@ namespace Kratos
 ///@name Kratos Classes
 ///@{
 
+/// Evaluate the components of a load over a batch of points into a strided buffer. A component is written
+/// directly into the buffer when it is contiguous, otherwise it goes through a small scratch block.
+inline void LoadFunction_GetValues(const FunctionR3R1::Pointer* pComponents, const std::size_t ncomponent,
+        const FunctionR3R1::InputType* P, const std::size_t n, double* Buffer, const std::size_t Stride)
+{
+    if (ncomponent > Stride)
+        KRATOS_THROW_ERROR(std::logic_error, "The stride is smaller than the number of components", Stride)
+
+    if ((ncomponent == 1) && (Stride == 1))
+    {
+        pComponents[0]->GetValues(P, n, Buffer);
+        return;
+    }
+
+    const std::size_t block_size = 64;
+    double ComponentValues[block_size];
+    for (std::size_t begin = 0; begin < n; begin += block_size)
+    {
+        const std::size_t size = std::min(block_size, n - begin);
+        for (std::size_t j = 0; j < ncomponent; ++j)
+        {
+            pComponents[j]->GetValues(P + begin, size, ComponentValues);
+            for (std::size_t i = 0; i < size; ++i)
+                Buffer[(begin + i)*Stride + j] = ComponentValues[i];
+        }
+    }
+}
+
+
 /// Short class definition.
 /** Class for the load apply on line/surface
 */
@@ -85,7 +117,7 @@ public:
 
     /// Copy constructor.
     LoadFunctionR3Rn(LoadFunctionR3Rn const& rOther)
-    : BaseType(rOther)
+    : BaseType(rOther), mpLoadComponents(rOther.mpLoadComponents)
     {}
 
     /// Destructor.
@@ -113,14 +145,50 @@ public:
     }
 
     virtual OutputType GetValue(const InputType& P) const
+    {
+        Vector Load(mpLoadComponents.size());
+        this->GetValue(P, Load);
+        return Load;
+    }
+
+    /// Evaluate the load into the given vector; the vector is only resized if it does not have the right size
+    virtual void GetValue(const InputType& P, OutputType& rValue) const
     {
         std::size_t ncomponent = mpLoadComponents.size();
-        Vector Load(ncomponent);
+        if (rValue.size() != ncomponent)
+            rValue.resize(ncomponent, false);
 
         for (std::size_t i = 0; i < ncomponent; ++i)
-            Load(i) = mpLoadComponents[i]->GetValue(P);
+            rValue(i) = mpLoadComponents[i]->GetValue(P);
+    }
 
-        return Load;
+    /// Evaluate the components one after another over the whole batch
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        std::size_t ncomponent = mpLoadComponents.size();
+
+        for (std::size_t i = 0; i < n; ++i)
+            if (Values[i].size() != ncomponent)
+                Values[i].resize(ncomponent, false);
+
+        std::vector<double> ComponentValues(n);
+        for (std::size_t j = 0; j < ncomponent; ++j)
+        {
+            if (n != 0)
+                mpLoadComponents[j]->GetValues(P, n, &ComponentValues[0]);
+            for (std::size_t i = 0; i < n; ++i)
+                Values[i](j) = ComponentValues[i];
+        }
+    }
+
+    /// Evaluate the load at a batch of n points and write it to an assembly buffer of n*Stride entries.
+    /// The load of point i is written to Buffer[i*Stride], ..., Buffer[i*Stride + ncomponent - 1]; nothing is written
+    /// if no component is set.
+    void GetValues(const InputType* P, const std::size_t n, double* Buffer, const std::size_t Stride) const
+    {
+        if (mpLoadComponents.empty())
+            return;
+        LoadFunction_GetValues(&mpLoadComponents[0], mpLoadComponents.size(), P, n, Buffer, Stride);
     }
 
     ///@}
@@ -221,6 +289,20 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("LoadComponents", mpLoadComponents);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        mpLoadComponents.clear();
+        rSerializer.load("LoadComponents", mpLoadComponents);
+    }
 
     ///@}
     ///@name Private  Access
@@ -243,6 +325,189 @@ private:
 
 }; // Class LoadFunctionR3Rn
 
+
+/// Short class definition.
+/** Class for the load apply on line/surface with a fixed number of components. The load is returned
+ * in an array_1d, hence no memory is allocated to evaluate it.
+*/
+template<std::size_t TDim>
+class LoadFunctionR3RN : public Function<array_1d<double, 3>, array_1d<double, TDim> >
+{
+public:
+    ///@name Type Definitions
+    ///@{
+
+    /// Pointer definition of LoadFunctionR3RN
+    KRATOS_CLASS_POINTER_DEFINITION(LoadFunctionR3RN);
+
+    typedef Function<array_1d<double, 3>, array_1d<double, TDim> > BaseType;
+
+    typedef typename BaseType::InputType InputType;
+
+    typedef typename BaseType::OutputType OutputType;
+
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// Default constructor. All the components are zero.
+    LoadFunctionR3RN()
+    : BaseType()
+    {
+        for (std::size_t i = 0; i < TDim; ++i)
+            mpLoadComponents[i] = ZeroFunction<FunctionR3R1>::Create();
+    }
+
+    /// Copy constructor.
+    LoadFunctionR3RN(LoadFunctionR3RN const& rOther)
+    : BaseType(rOther)
+    {
+        for (std::size_t i = 0; i < TDim; ++i)
+            mpLoadComponents[i] = rOther.mpLoadComponents[i];
+    }
+
+    /// Destructor.
+    virtual ~LoadFunctionR3RN()
+    {}
+
+
+    ///@}
+    ///@name Operators
+    ///@{
+
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+    virtual typename BaseType::Pointer CloneFunction() const
+    {
+        return typename BaseType::Pointer(new LoadFunctionR3RN(*this));
+    }
+
+    void SetComponent(const std::size_t& i, FunctionR3R1::Pointer pComp)
+    {
+        if (i >= TDim)
+            KRATOS_THROW_ERROR(std::logic_error, "Invalid component", i)
+        mpLoadComponents[i] = pComp;
+    }
+
+    virtual OutputType GetValue(const InputType& P) const
+    {
+        OutputType Load;
+        for (std::size_t i = 0; i < TDim; ++i)
+            Load[i] = mpLoadComponents[i]->GetValue(P);
+        return Load;
+    }
+
+    virtual void GetValue(const InputType& P, OutputType& rValue) const
+    {
+        for (std::size_t i = 0; i < TDim; ++i)
+            rValue[i] = mpLoadComponents[i]->GetValue(P);
+    }
+
+    /// Evaluate the components one after another over the whole batch
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        const std::size_t block_size = 64;
+        double ComponentValues[block_size];
+        for (std::size_t begin = 0; begin < n; begin += block_size)
+        {
+            const std::size_t size = std::min(block_size, n - begin);
+            for (std::size_t j = 0; j < TDim; ++j)
+            {
+                mpLoadComponents[j]->GetValues(P + begin, size, ComponentValues);
+                for (std::size_t i = 0; i < size; ++i)
+                    Values[begin + i][j] = ComponentValues[i];
+            }
+        }
+    }
+
+    /// Evaluate the load at a batch of n points and write it to an assembly buffer of n*Stride entries.
+    /// The load of point i is written to Buffer[i*Stride], ..., Buffer[i*Stride + TDim - 1].
+    void GetValues(const InputType* P, const std::size_t n, double* Buffer, const std::size_t Stride) const
+    {
+        LoadFunction_GetValues(mpLoadComponents, TDim, P, n, Buffer, Stride);
+    }
+
+    ///@}
+    ///@name Access
+    ///@{
+
+
+    ///@}
+    ///@name Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Input and output
+    ///@{
+
+    /// Turn back information as a string.
+    virtual std::string Info() const
+    {
+        std::stringstream ss;
+        ss << "Load Function R^3->R^" << TDim;
+        return ss.str();
+    }
+
+    /// Print information about this object.
+    virtual void PrintInfo(std::ostream& rOStream) const
+    {
+        rOStream << Info();
+    }
+
+    /// Print object's data.
+    virtual void PrintData(std::ostream& rOStream) const
+    {
+    }
+
+
+    ///@}
+
+private:
+    ///@name Member Variables
+    ///@{
+
+    FunctionR3R1::Pointer mpLoadComponents[TDim];
+
+    ///@}
+    ///@name Private Operations
+    ///@{
+
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        for (std::size_t i = 0; i < TDim; ++i)
+            rSerializer.save("LoadComponent", mpLoadComponents[i]);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        for (std::size_t i = 0; i < TDim; ++i)
+        {
+            // the components are created by the serializer with their saved type
+            mpLoadComponents[i].reset();
+            rSerializer.load("LoadComponent", mpLoadComponents[i]);
+        }
+    }
+
+    ///@}
+    ///@name Un accessible methods
+    ///@{
+
+    /// Assignment operator.
+    LoadFunctionR3RN& operator=(LoadFunctionR3RN const& rOther);
+
+    ///@}
+
+}; // Class LoadFunctionR3RN
+
 ///@}
 
 ///@name Type Definitions
@@ -267,6 +532,17 @@ inline std::ostream& operator << (std::ostream& rOStream, const LoadFunctionR3Rn
 
     return rOStream;
 }
+
+/// output stream LoadFunctionR3RN
+template<std::size_t TDim>
+inline std::ostream& operator << (std::ostream& rOStream, const LoadFunctionR3RN<TDim>& rThis)
+{
+    rThis.PrintInfo(rOStream);
+    rOStream << std::endl;
+    rThis.PrintData(rOStream);
+
+    return rOStream;
+}
 ///@}
 
 ///@} addtogroup block
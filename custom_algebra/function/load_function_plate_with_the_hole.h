@@ -84,6 +84,10 @@ public:
     : BaseType(), mP(P), mr(r)
     {}
 
+    /// Default constructor, only used by the serializer.
+    LoadFunctionR3RnPlateWithTheHole() : BaseType(), mP(0.0), mr(0.0)
+    {}
+
     /// Copy constructor.
     LoadFunctionR3RnPlateWithTheHole(LoadFunctionR3RnPlateWithTheHole const& rOther)
     : BaseType(rOther), mP(rOther.mP), mr(rOther.mr)
@@ -238,6 +242,21 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("P", mP);
+        rSerializer.save("r", mr);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("P", mP);
+        rSerializer.load("r", mr);
+    }
 
     ///@}
     ///@name Private  Access
@@ -28,6 +28,7 @@
 // Project includes
 #include "includes/define.h"
 #include "custom_algebra/function/function.h"
+#include "custom_utilities/symbolic_expression.h"
 #include "mathpresso/mathpresso.h"
 
 
@@ -57,6 +58,8 @@ namespace Kratos
 
 /// Short class definition.
 /** Class for a general MathPressoFunctionR3R1
+ * The compiled expression is immutable after the construction and shared by all the clones of the function.
+ * The derivatives are obtained by symbolic differentiation of the expression, which is then compiled again.
 */
 class MathPressoFunctionR3R1 : public FunctionR3R1
 {
@@ -73,6 +76,13 @@ public:
 
     typedef typename BaseType::OutputType OutputType;
 
+    /// The MathPresso context and the expression compiled within it
+    struct CompiledExpression
+    {
+        mathpresso::Context Ctx;
+        mathpresso::Expression Exp;
+    };
+
 
     ///@}
     ///@name Life Cycle
@@ -85,12 +95,14 @@ public:
         this->Initialize(expression);
     }
 
-    /// Copy constructor.
+    /// Default constructor, only used by the serializer.
+    MathPressoFunctionR3R1() : BaseType()
+    {}
+
+    /// Copy constructor. The compiled expression is shared, so cloning does not compile the expression again.
     MathPressoFunctionR3R1(MathPressoFunctionR3R1 const& rOther)
-    : BaseType(rOther), mStr(rOther.mStr)
-    {
-        this->Initialize(rOther.mStr);
-    }
+    : BaseType(rOther), mpCompiled(rOther.mpCompiled), mStr(rOther.mStr)
+    {}
 
     /// Destructor.
     virtual ~MathPressoFunctionR3R1()
@@ -109,9 +121,13 @@ public:
 
     void Initialize(const std::string& expression)
     {
+        boost::shared_ptr<CompiledExpression> pCompiled = boost::shared_ptr<CompiledExpression>(new CompiledExpression());
+        mathpresso::Context& rCtx = pCompiled->Ctx;
+        mathpresso::Expression& rExp = pCompiled->Exp;
+
         // Initialize the context by adding MathPresso built-ins. Without this line
         // functions like round(), sin(), etc won't be available.
-        mCtx.addBuiltIns();
+        rCtx.addBuiltIns();
 
         // Let the context know the name of the variables we will refer to and
         // their positions in the data pointer. We will use an array of 3 doubles,
@@ -119,9 +135,9 @@ public:
         //
         // The `addVariable()` also contains a third parameter that describes
         // variable flags, use `kVariableRO` to make a certain variable read-only.
-        mCtx.addVariable("x", 0 * sizeof(double));
-        mCtx.addVariable("y", 1 * sizeof(double));
-        mCtx.addVariable("z", 2 * sizeof(double));
+        rCtx.addVariable("x", 0 * sizeof(double));
+        rCtx.addVariable("y", 1 * sizeof(double));
+        rCtx.addVariable("z", 2 * sizeof(double));
 
         // Compile the expression.
         //
@@ -129,13 +145,15 @@ public:
         //   1. `mathpresso::Context&` - The expression's context / environment.
         //   2. `const char* body` - The expression body.
         //   3. `unsigned int` - Options, just pass `mathpresso::kNoOptions`.
-        mathpresso::Error err = mExp.compile(mCtx, expression.c_str(), mathpresso::kNoOptions);
+        mathpresso::Error err = rExp.compile(rCtx, expression.c_str(), mathpresso::kNoOptions);
 
         // Handle possible syntax or compilation error.
         if (err != mathpresso::kErrorOk)
         {
             KRATOS_THROW_ERROR(std::logic_error, "Expression Error: ", err);
         }
+
+        mpCompiled = pCompiled;
     }
 
 
@@ -151,7 +169,22 @@ public:
         data[0] = P[0];
         data[1] = P[1];
         data[2] = P[2];
-        return mExp.evaluate(data);
+        return mpCompiled->Exp.evaluate(data);
+    }
+
+
+    /// The compiled expression evaluates one point per call, hence the batch is looped here, reusing the same data buffer
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        const mathpresso::Expression& rExp = mpCompiled->Exp;
+        double data[3];
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            data[0] = P[i][0];
+            data[1] = P[i][1];
+            data[2] = P[i][2];
+            Values[i] = rExp.evaluate(data);
+        }
     }
 
 
@@ -161,10 +194,16 @@ public:
     }
 
 
-//    virtual typename BaseType::Pointer GetDiffFunction(const int& component) const
-//    {
-//        return typename BaseType::Pointer(new ZeroFunction<BaseType>());
-//    }
+    virtual BaseType::Pointer GetDiffFunction(const int& component) const
+    {
+        const char* variables[] = {"x", "y", "z"};
+        if(component < 0 || component > 2)
+            KRATOS_THROW_ERROR(std::logic_error, "Invalid component", component)
+
+        SymbolicExpression::Pointer pExpr = SymbolicExpression::Parse(mStr);
+        SymbolicExpression::Pointer pDiff = pExpr->Differentiate(variables[component]);
+        return BaseType::Pointer(new MathPressoFunctionR3R1(pDiff->ToString()));
+    }
 
 
     ///@}
@@ -253,8 +292,7 @@ private:
     ///@name Member Variables
     ///@{
 
-    mathpresso::Context mCtx;
-    mathpresso::Expression mExp;
+    boost::shared_ptr<const CompiledExpression> mpCompiled;
     std::string mStr;
 
     ///@}
@@ -266,6 +304,21 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    /// Only the expression is saved; it is compiled again when it is loaded
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("Expression", mStr);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("Expression", mStr);
+        this->Initialize(mStr);
+    }
 
     ///@}
     ///@name Private  Access
@@ -20,6 +20,8 @@
 // System includes
 #include <string>
 #include <iostream>
+#include <typeinfo>
+#include <algorithm>
 
 
 // External includes
@@ -30,6 +32,7 @@
 #include "custom_algebra/function/function.h"
 #include "custom_algebra/function/scale_function.h"
 #include "custom_algebra/function/zero_function.h"
+#include "custom_algebra/function/scalar_function.h"
 #include "custom_algebra/level_set/level_set.h"
 
 
@@ -57,6 +60,50 @@ namespace Kratos
 ///@name Kratos Classes
 ///@{
 
+/// Helper to compute the integer power x^TDegree by successive multiplication
+template<std::size_t TDegree>
+struct MonomialPower
+{
+    static inline double Eval(const double& x)
+    {
+        return x * MonomialPower<TDegree-1>::Eval(x);
+    }
+};
+
+template<>
+struct MonomialPower<0>
+{
+    static inline double Eval(const double& x)
+    {
+        return 1.0;
+    }
+};
+
+/// Helper to compute the dual number of the monomial x_0^Degrees[0] * x_1^Degrees[1] * ...
+template<typename TDualType, typename TInputType>
+inline TDualType MonomialDualValue(const TInputType& P, const std::size_t* Degrees)
+{
+    typedef DualNumberTraits<TInputType> TraitsType;
+    TDualType Result(1.0);
+    for(std::size_t k = 0; k < TraitsType::Dimension; ++k)
+    {
+        if(Degrees[k] == 0)
+            continue;
+        const double x = TraitsType::Component(P, k);
+        const double d = static_cast<double>(Degrees[k]);
+        if(Degrees[k] == 1)
+        {
+            Result *= TDualType::Variable(x, k);
+        }
+        else
+        {
+            const double p = pow(x, Degrees[k]-2);
+            Result *= TDualType::Variable(x, k).Compose(p*x*x, d*p*x, d*(d-1.0)*p);
+        }
+    }
+    return Result;
+}
+
 /// Short class definition.
 /** Class for a general MonomialFunctionR3R1
 */
@@ -155,6 +202,46 @@ public:
     }
 
 
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = MonomialPower<TDegreeX>::Eval(P[i][0]) * MonomialPower<TDegreeY>::Eval(P[i][1]) * MonomialPower<TDegreeZ>::Eval(P[i][2]);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, TDegreeY, TDegreeZ};
+        return rTape.AddMonomial(Degrees, 3);
+    }
+
+
+    virtual BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, TDegreeY, TDegreeZ};
+        return MonomialDualValue<BaseType::DualType>(P, Degrees);
+    }
+
+
+    virtual BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, TDegreeY, TDegreeZ};
+        return MonomialDualValue<BaseType::GradientDualType>(P, Degrees);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual BaseType::Pointer SimplifyFunction(BaseType::SimplifyData& rData) const
+    {
+        return BaseType::ShareFunction(rData, typeid(*this).name(), this->CloneFunction());
+    }
+
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return GetFormulaMonomialFunctionR3R1<TDegreeX, TDegreeY, TDegreeZ>(Format);
@@ -173,7 +260,7 @@ public:
         }
         else if(component == 2)
         {
-            return BaseType::Pointer(new ScaleFunction<BaseType>(TDegreeY, BaseType::Pointer(new MonomialFunctionR3R1<TDegreeX, TDegreeY, TDegreeZ-1>())));
+            return BaseType::Pointer(new ScaleFunction<BaseType>(TDegreeZ, BaseType::Pointer(new MonomialFunctionR3R1<TDegreeX, TDegreeY, TDegreeZ-1>())));
         }
         else
             return BaseType::Pointer(new ZeroFunction<BaseType>());
@@ -321,6 +408,46 @@ public:
         return pow(P[1], TDegreeY) * pow(P[2], TDegreeZ);
     }
 
+
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = MonomialPower<TDegreeY>::Eval(P[i][1]) * MonomialPower<TDegreeZ>::Eval(P[i][2]);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        const std::size_t Degrees[] = {0, TDegreeY, TDegreeZ};
+        return rTape.AddMonomial(Degrees, 3);
+    }
+
+
+    virtual BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {0, TDegreeY, TDegreeZ};
+        return MonomialDualValue<BaseType::DualType>(P, Degrees);
+    }
+
+
+    virtual BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {0, TDegreeY, TDegreeZ};
+        return MonomialDualValue<BaseType::GradientDualType>(P, Degrees);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual BaseType::Pointer SimplifyFunction(BaseType::SimplifyData& rData) const
+    {
+        return BaseType::ShareFunction(rData, typeid(*this).name(), this->CloneFunction());
+    }
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return GetFormulaMonomialFunctionR3R1<0, TDegreeY, TDegreeZ>(Format);
@@ -368,6 +495,46 @@ public:
         return pow(P[0], TDegreeX) * pow(P[2], TDegreeZ);
     }
 
+
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = MonomialPower<TDegreeX>::Eval(P[i][0]) * MonomialPower<TDegreeZ>::Eval(P[i][2]);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, 0, TDegreeZ};
+        return rTape.AddMonomial(Degrees, 3);
+    }
+
+
+    virtual BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, 0, TDegreeZ};
+        return MonomialDualValue<BaseType::DualType>(P, Degrees);
+    }
+
+
+    virtual BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, 0, TDegreeZ};
+        return MonomialDualValue<BaseType::GradientDualType>(P, Degrees);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual BaseType::Pointer SimplifyFunction(BaseType::SimplifyData& rData) const
+    {
+        return BaseType::ShareFunction(rData, typeid(*this).name(), this->CloneFunction());
+    }
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return GetFormulaMonomialFunctionR3R1<TDegreeX, 0, TDegreeZ>(Format);
@@ -415,6 +582,46 @@ public:
         return pow(P[0], TDegreeX) * pow(P[1], TDegreeY);
     }
 
+
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = MonomialPower<TDegreeX>::Eval(P[i][0]) * MonomialPower<TDegreeY>::Eval(P[i][1]);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, TDegreeY, 0};
+        return rTape.AddMonomial(Degrees, 3);
+    }
+
+
+    virtual BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, TDegreeY, 0};
+        return MonomialDualValue<BaseType::DualType>(P, Degrees);
+    }
+
+
+    virtual BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, TDegreeY, 0};
+        return MonomialDualValue<BaseType::GradientDualType>(P, Degrees);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual BaseType::Pointer SimplifyFunction(BaseType::SimplifyData& rData) const
+    {
+        return BaseType::ShareFunction(rData, typeid(*this).name(), this->CloneFunction());
+    }
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return GetFormulaMonomialFunctionR3R1<TDegreeX, TDegreeY, 0>(Format);
@@ -462,6 +669,46 @@ public:
         return pow(P[0], TDegreeX);
     }
 
+
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = MonomialPower<TDegreeX>::Eval(P[i][0]);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, 0, 0};
+        return rTape.AddMonomial(Degrees, 3);
+    }
+
+
+    virtual BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, 0, 0};
+        return MonomialDualValue<BaseType::DualType>(P, Degrees);
+    }
+
+
+    virtual BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, 0, 0};
+        return MonomialDualValue<BaseType::GradientDualType>(P, Degrees);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual BaseType::Pointer SimplifyFunction(BaseType::SimplifyData& rData) const
+    {
+        return BaseType::ShareFunction(rData, typeid(*this).name(), this->CloneFunction());
+    }
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return GetFormulaMonomialFunctionR3R1<TDegreeX, 0, 0>(Format);
@@ -509,6 +756,46 @@ public:
         return pow(P[1], TDegreeY);
     }
 
+
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = MonomialPower<TDegreeY>::Eval(P[i][1]);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        const std::size_t Degrees[] = {0, TDegreeY, 0};
+        return rTape.AddMonomial(Degrees, 3);
+    }
+
+
+    virtual BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {0, TDegreeY, 0};
+        return MonomialDualValue<BaseType::DualType>(P, Degrees);
+    }
+
+
+    virtual BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {0, TDegreeY, 0};
+        return MonomialDualValue<BaseType::GradientDualType>(P, Degrees);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual BaseType::Pointer SimplifyFunction(BaseType::SimplifyData& rData) const
+    {
+        return BaseType::ShareFunction(rData, typeid(*this).name(), this->CloneFunction());
+    }
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return GetFormulaMonomialFunctionR3R1<0, TDegreeY, 0>(Format);
@@ -556,6 +843,46 @@ public:
         return pow(P[2], TDegreeZ);
     }
 
+
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = MonomialPower<TDegreeZ>::Eval(P[i][2]);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        const std::size_t Degrees[] = {0, 0, TDegreeZ};
+        return rTape.AddMonomial(Degrees, 3);
+    }
+
+
+    virtual BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {0, 0, TDegreeZ};
+        return MonomialDualValue<BaseType::DualType>(P, Degrees);
+    }
+
+
+    virtual BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {0, 0, TDegreeZ};
+        return MonomialDualValue<BaseType::GradientDualType>(P, Degrees);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual BaseType::Pointer SimplifyFunction(BaseType::SimplifyData& rData) const
+    {
+        return BaseType::ShareFunction(rData, typeid(*this).name(), this->CloneFunction());
+    }
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return GetFormulaMonomialFunctionR3R1<0, 0, TDegreeZ>(Format);
@@ -603,6 +930,52 @@ public:
         return 1.0;
     }
 
+
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        std::fill(Values, Values + n, 1.0);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        const std::size_t Degrees[] = {0, 0, 0};
+        return rTape.AddMonomial(Degrees, 3);
+    }
+
+
+    virtual BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {0, 0, 0};
+        return MonomialDualValue<BaseType::DualType>(P, Degrees);
+    }
+
+
+    virtual BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {0, 0, 0};
+        return MonomialDualValue<BaseType::GradientDualType>(P, Degrees);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual BaseType::Pointer SimplifyFunction(BaseType::SimplifyData& rData) const
+    {
+        return ConstantFunctionFactory<BaseType>::Create(rData, 1.0);
+    }
+
+
+    virtual bool IsConstant(OutputType& rValue) const
+    {
+        rValue = 1.0;
+        return true;
+    }
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return GetFormulaMonomialFunctionR3R1<0, 0, 0>(Format);
@@ -676,6 +1049,46 @@ public:
     }
 
 
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = MonomialPower<TDegreeX>::Eval(P[i][0]) * MonomialPower<TDegreeY>::Eval(P[i][1]);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, TDegreeY};
+        return rTape.AddMonomial(Degrees, 2);
+    }
+
+
+    virtual BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, TDegreeY};
+        return MonomialDualValue<BaseType::DualType>(P, Degrees);
+    }
+
+
+    virtual BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, TDegreeY};
+        return MonomialDualValue<BaseType::GradientDualType>(P, Degrees);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual BaseType::Pointer SimplifyFunction(BaseType::SimplifyData& rData) const
+    {
+        return BaseType::ShareFunction(rData, typeid(*this).name(), this->CloneFunction());
+    }
+
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return GetFormulaMonomialFunctionR3R1<TDegreeX, TDegreeY, 0>(Format);
@@ -837,6 +1250,46 @@ public:
         return pow(P[0], TDegreeX);
     }
 
+
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = MonomialPower<TDegreeX>::Eval(P[i][0]);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, 0};
+        return rTape.AddMonomial(Degrees, 2);
+    }
+
+
+    virtual BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, 0};
+        return MonomialDualValue<BaseType::DualType>(P, Degrees);
+    }
+
+
+    virtual BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {TDegreeX, 0};
+        return MonomialDualValue<BaseType::GradientDualType>(P, Degrees);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual BaseType::Pointer SimplifyFunction(BaseType::SimplifyData& rData) const
+    {
+        return BaseType::ShareFunction(rData, typeid(*this).name(), this->CloneFunction());
+    }
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return GetFormulaMonomialFunctionR3R1<TDegreeX, 0, 0>(Format);
@@ -880,6 +1333,46 @@ public:
         return pow(P[1], TDegreeY);
     }
 
+
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = MonomialPower<TDegreeY>::Eval(P[i][1]);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        const std::size_t Degrees[] = {0, TDegreeY};
+        return rTape.AddMonomial(Degrees, 2);
+    }
+
+
+    virtual BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {0, TDegreeY};
+        return MonomialDualValue<BaseType::DualType>(P, Degrees);
+    }
+
+
+    virtual BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {0, TDegreeY};
+        return MonomialDualValue<BaseType::GradientDualType>(P, Degrees);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual BaseType::Pointer SimplifyFunction(BaseType::SimplifyData& rData) const
+    {
+        return BaseType::ShareFunction(rData, typeid(*this).name(), this->CloneFunction());
+    }
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return GetFormulaMonomialFunctionR3R1<0, TDegreeY, 0>(Format);
@@ -923,6 +1416,52 @@ public:
         return 1.0;
     }
 
+
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        std::fill(Values, Values + n, 1.0);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        const std::size_t Degrees[] = {0, 0};
+        return rTape.AddMonomial(Degrees, 2);
+    }
+
+
+    virtual BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {0, 0};
+        return MonomialDualValue<BaseType::DualType>(P, Degrees);
+    }
+
+
+    virtual BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {0, 0};
+        return MonomialDualValue<BaseType::GradientDualType>(P, Degrees);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual BaseType::Pointer SimplifyFunction(BaseType::SimplifyData& rData) const
+    {
+        return ConstantFunctionFactory<BaseType>::Create(rData, 1.0);
+    }
+
+
+    virtual bool IsConstant(OutputType& rValue) const
+    {
+        rValue = 1.0;
+        return true;
+    }
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return GetFormulaMonomialFunctionR3R1<0, 0, 0>(Format);
@@ -992,6 +1531,46 @@ public:
     }
 
 
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = MonomialPower<TDegree>::Eval(P[i]);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        const std::size_t Degrees[] = {TDegree};
+        return rTape.AddMonomial(Degrees, 1);
+    }
+
+
+    virtual BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {TDegree};
+        return MonomialDualValue<BaseType::DualType>(P, Degrees);
+    }
+
+
+    virtual BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {TDegree};
+        return MonomialDualValue<BaseType::GradientDualType>(P, Degrees);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual BaseType::Pointer SimplifyFunction(BaseType::SimplifyData& rData) const
+    {
+        return BaseType::ShareFunction(rData, typeid(*this).name(), this->CloneFunction());
+    }
+
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return GetFormulaMonomialFunctionR3R1<TDegree, 0, 0>(Format);
@@ -1153,6 +1732,52 @@ public:
         return 1.0;
     }
 
+
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        std::fill(Values, Values + n, 1.0);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        const std::size_t Degrees[] = {0};
+        return rTape.AddMonomial(Degrees, 1);
+    }
+
+
+    virtual BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {0};
+        return MonomialDualValue<BaseType::DualType>(P, Degrees);
+    }
+
+
+    virtual BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        const std::size_t Degrees[] = {0};
+        return MonomialDualValue<BaseType::GradientDualType>(P, Degrees);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual BaseType::Pointer SimplifyFunction(BaseType::SimplifyData& rData) const
+    {
+        return ConstantFunctionFactory<BaseType>::Create(rData, 1.0);
+    }
+
+
+    virtual bool IsConstant(OutputType& rValue) const
+    {
+        rValue = 1.0;
+        return true;
+    }
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return GetFormulaMonomialFunctionR3R1<0, 0, 0>(Format);
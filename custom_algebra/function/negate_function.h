@@ -28,6 +28,7 @@
 // Project includes
 #include "includes/define.h"
 #include "custom_algebra/function/function.h"
+#include "custom_algebra/function/scale_function.h"
 
 
 namespace Kratos
@@ -83,6 +84,10 @@ public:
     : BaseType(), mp_func(p_func)
     {}
 
+    /// Default constructor, only used by the serializer.
+    NegateFunction() : BaseType()
+    {}
+
     /// Copy constructor.
     NegateFunction(NegateFunction const& rOther)
     : BaseType(rOther), mp_func(rOther.mp_func->CloneFunction())
@@ -115,6 +120,38 @@ public:
     }
 
 
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        mp_func->GetValues(P, n, Values);
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = -Values[i];
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        return rTape.AddUnary(FunctionTape<InputType, OutputType>::NEGATE, mp_func->Compile(rTape));
+    }
+
+
+    virtual typename BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        return -mp_func->GetDualValue(P);
+    }
+
+
+    virtual typename BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        return -mp_func->GetGradientDualValue(P);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return mp_func->HasDualValue();
+    }
+
+
     virtual double GetDerivative(const int& component, const InputType& P) const
     {
         return -mp_func->GetDerivative(component, P);
@@ -127,6 +164,13 @@ public:
     }
 
 
+    /// The negation is simplified as a scale of -1, so that it can be merged with the other scales
+    virtual typename BaseType::Pointer SimplifyFunction(typename BaseType::SimplifyData& rData) const
+    {
+        return ScaleFunction<BaseType>(-1.0, mp_func->Simplify(rData)).SimplifyFunction(rData);
+    }
+
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         std::stringstream ss;
@@ -226,7 +270,7 @@ private:
     ///@name Member Variables
     ///@{
 
-    const typename BaseType::Pointer mp_func;
+    typename BaseType::Pointer mp_func;
 
     ///@}
     ///@name Private Operators
@@ -237,6 +281,19 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("Function", mp_func);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("Function", mp_func);
+    }
 
     ///@}
     ///@name Private  Access
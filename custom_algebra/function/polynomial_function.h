@@ -0,0 +1,559 @@
+//    |  /           |
+//    ' /   __| _` | __|  _ \   __|
+//    . \  |   (   | |   (   |\__ `
+//   _|\_\_|  \__,_|\__|\___/ ____/
+//                   Multi-Physics
+//
+//  License:         brep_application/LICENSE.txt
+//                   Kratos default license: kratos/license.txt
+//
+//  Main authors:    Hoang-Giang Bui
+//  Date:            16 Oct 2026
+//
+
+
+#if !defined(KRATOS_POLYNOMIAL_FUNCTION_H_INCLUDED )
+#define  KRATOS_POLYNOMIAL_FUNCTION_H_INCLUDED
+
+
+
+// System includes
+#include <string>
+#include <vector>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+
+
+// External includes
+
+
+// Project includes
+#include "includes/define.h"
+#include "custom_algebra/function/function.h"
+#include "custom_algebra/function/scalar_function.h"
+
+
+namespace Kratos
+{
+///@addtogroup BRepApplication
+///@{
+
+///@name Kratos Globals
+///@{
+
+///@}
+///@name Type Definitions
+///@{
+
+///@}
+///@name  Enum's
+///@{
+
+///@}
+///@name  Functions
+///@{
+
+///@}
+///@name Kratos Classes
+///@{
+
+/// Short class definition.
+/** Class for a sparse multivariate polynomial sum_i c_i * x_0^e_i0 * x_1^e_i1 * ...
+ * The terms are kept in a compact table, sorted lexicographically by the exponents with the highest exponents first.
+ * The polynomial is evaluated by a nested Horner scheme, i.e. the terms are grouped by the exponent of x_0, then the
+ * coefficient of each group is a polynomial in x_1, ..., which is evaluated in the same way.
+*/
+template<class TFunction>
+class PolynomialFunction : public TFunction
+{
+public:
+    ///@name Type Definitions
+    ///@{
+
+    /// Pointer definition of PolynomialFunction
+    KRATOS_CLASS_POINTER_DEFINITION(PolynomialFunction);
+
+    typedef TFunction BaseType;
+
+    typedef typename BaseType::InputType InputType;
+
+    typedef typename BaseType::OutputType OutputType;
+
+    typedef typename BaseType::DualType DualType;
+
+    typedef typename BaseType::GradientDualType GradientDualType;
+
+    typedef typename BaseType::DualTraitsType DualTraitsType;
+
+    static const std::size_t Dimension = DualTraitsType::Dimension;
+
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// Default constructor.
+    PolynomialFunction() : BaseType()
+    {}
+
+    /// Copy constructor.
+    PolynomialFunction(PolynomialFunction const& rOther)
+    : BaseType(rOther)
+    , mCoefficients(rOther.mCoefficients)
+    , mExponents(rOther.mExponents)
+    {}
+
+    /// Destructor.
+    virtual ~PolynomialFunction()
+    {}
+
+
+    ///@}
+    ///@name Operators
+    ///@{
+
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+
+    virtual typename BaseType::Pointer CloneFunction() const
+    {
+        return typename BaseType::Pointer(new PolynomialFunction(*this));
+    }
+
+
+    /// Add the term c * x_0^Exponents[0] * x_1^Exponents[1] * ... The terms with the same exponents are merged.
+    void AddTerm(const double& c, const std::vector<std::size_t>& Exponents)
+    {
+        if(Exponents.size() != Dimension)
+            KRATOS_THROW_ERROR(std::logic_error, "The number of exponents is not equal to the input size", Exponents.size())
+
+        if(c == 0.0)
+            return;
+
+        // find the position of the term in the sorted table
+        std::size_t i = 0;
+        int cmp = 1;
+        for(; i < mCoefficients.size(); ++i)
+        {
+            cmp = CompareExponents(&mExponents[i*Dimension], &Exponents[0]);
+            if(cmp >= 0)
+                break;
+        }
+
+        if(cmp == 0)
+        {
+            mCoefficients[i] += c;
+            if(mCoefficients[i] == 0.0)
+            {
+                mCoefficients.erase(mCoefficients.begin() + i);
+                mExponents.erase(mExponents.begin() + i*Dimension, mExponents.begin() + (i+1)*Dimension);
+            }
+        }
+        else
+        {
+            mCoefficients.insert(mCoefficients.begin() + i, c);
+            mExponents.insert(mExponents.begin() + i*Dimension, Exponents.begin(), Exponents.end());
+        }
+    }
+
+
+    virtual double GetValue(const InputType& P) const
+    {
+        if(mCoefficients.size() == 0)
+            return 0.0;
+
+        double X[Dimension];
+        for(std::size_t k = 0; k < Dimension; ++k)
+            X[k] = DualTraitsType::Component(P, k);
+
+        return Horner<double>(0, 0, mCoefficients.size(), X);
+    }
+
+
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        if(mCoefficients.size() == 0)
+        {
+            std::fill(Values, Values + n, 0.0);
+            return;
+        }
+
+        double X[Dimension];
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            for(std::size_t k = 0; k < Dimension; ++k)
+                X[k] = DualTraitsType::Component(P[i], k);
+            Values[i] = Horner<double>(0, 0, mCoefficients.size(), X);
+        }
+    }
+
+
+    virtual DualType GetDualValue(const InputType& P) const
+    {
+        if(mCoefficients.size() == 0)
+            return DualType(0.0);
+
+        DualType X[Dimension];
+        for(std::size_t k = 0; k < Dimension; ++k)
+            X[k] = DualType::Variable(DualTraitsType::Component(P, k), k);
+
+        return Horner<DualType>(0, 0, mCoefficients.size(), X);
+    }
+
+
+    virtual GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        if(mCoefficients.size() == 0)
+            return GradientDualType(0.0);
+
+        GradientDualType X[Dimension];
+        for(std::size_t k = 0; k < Dimension; ++k)
+            X[k] = GradientDualType::Variable(DualTraitsType::Component(P, k), k);
+
+        return Horner<GradientDualType>(0, 0, mCoefficients.size(), X);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual typename BaseType::Pointer SimplifyFunction(typename BaseType::SimplifyData& rData) const
+    {
+        OutputType v;
+        if(this->IsConstant(v))
+            return ConstantFunctionFactory<BaseType>::Create(rData, v);
+        return this->CloneFunction();
+    }
+
+
+    virtual bool IsConstant(OutputType& rValue) const
+    {
+        if(mCoefficients.size() == 0)
+        {
+            rValue = 0.0;
+            return true;
+        }
+
+        if((mCoefficients.size() == 1) && (static_cast<std::size_t>(std::count(mExponents.begin(), mExponents.end(), 0)) == Dimension))
+        {
+            rValue = mCoefficients[0];
+            return true;
+        }
+
+        return false;
+    }
+
+
+    virtual std::string GetFormula(const std::string& Format) const
+    {
+        std::stringstream ss;
+        if(mCoefficients.size() == 0)
+            ss << "0.0";
+        for(std::size_t i = 0; i < mCoefficients.size(); ++i)
+        {
+            if(i != 0)
+                ss << "+";
+            ss << mCoefficients[i];
+            for(std::size_t k = 0; k < Dimension; ++k)
+            {
+                const std::size_t e = mExponents[i*Dimension + k];
+                if(e == 0)
+                    continue;
+                ss << "*" << VariableName(k);
+                if(e != 1)
+                    ss << "^" << e;
+            }
+        }
+        return ss.str();
+    }
+
+
+    virtual typename BaseType::Pointer GetDiffFunction(const int& component) const
+    {
+        typename PolynomialFunction::Pointer pFunc = typename PolynomialFunction::Pointer(new PolynomialFunction());
+
+        if(static_cast<std::size_t>(component) >= Dimension)
+            return pFunc;
+
+        std::vector<std::size_t> Exponents(Dimension);
+        for(std::size_t i = 0; i < mCoefficients.size(); ++i)
+        {
+            const std::size_t e = mExponents[i*Dimension + component];
+            if(e == 0)
+                continue;
+
+            std::copy(mExponents.begin() + i*Dimension, mExponents.begin() + (i+1)*Dimension, Exponents.begin());
+            --Exponents[component];
+            pFunc->AddTerm(e*mCoefficients[i], Exponents);
+        }
+
+        return pFunc;
+    }
+
+
+    ///@}
+    ///@name Access
+    ///@{
+
+
+    /// Get the number of terms
+    std::size_t NumberOfTerms() const
+    {
+        return mCoefficients.size();
+    }
+
+
+    ///@}
+    ///@name Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Input and output
+    ///@{
+
+    /// Turn back information as a string.
+    virtual std::string Info() const
+    {
+        return "Polynomial Function";
+    }
+
+    /// Print information about this object.
+    virtual void PrintInfo(std::ostream& rOStream) const
+    {
+        rOStream << Info();
+    }
+
+    /// Print object's data.
+    virtual void PrintData(std::ostream& rOStream) const
+    {
+        rOStream << " Number of terms: " << mCoefficients.size() << std::endl;
+        rOStream << " " << this->GetFormula("matlab");
+    }
+
+
+    ///@}
+    ///@name Friends
+    ///@{
+
+
+    ///@}
+
+protected:
+    ///@name Protected static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Protected member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Protected Operators
+    ///@{
+
+
+    ///@}
+    ///@name Protected Operations
+    ///@{
+
+
+    ///@}
+    ///@name Protected  Access
+    ///@{
+
+
+    ///@}
+    ///@name Protected Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Protected LifeCycle
+    ///@{
+
+
+    ///@}
+
+private:
+    ///@name Static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Member Variables
+    ///@{
+
+    std::vector<double> mCoefficients; // coefficient of each term
+    std::vector<std::size_t> mExponents; // exponents of each term, stored contiguously by term
+
+    ///@}
+    ///@name Private Operators
+    ///@{
+
+
+    ///@}
+    ///@name Private Operations
+    ///@{
+
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("Coefficients", mCoefficients);
+        rSerializer.save("Exponents", mExponents);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("Coefficients", mCoefficients);
+        rSerializer.load("Exponents", mExponents);
+    }
+
+
+    /// Evaluate the terms [begin, end), which share the exponents of the variables before k, in the variables k, k+1, ...
+    /// The terms are grouped by the exponent of x_k in descending order, and the groups are combined by the Horner scheme
+    ///     (((c_1 * x_k^(e_1-e_2) + c_2) * x_k^(e_2-e_3) + ...) * x_k^e_n
+    /// where c_j is the polynomial of the group j in the remaining variables.
+    template<typename TValueType>
+    TValueType Horner(const std::size_t k, const std::size_t begin, const std::size_t end, const TValueType* X) const
+    {
+        if(k == Dimension)
+            return TValueType(mCoefficients[begin]);
+
+        TValueType Result(0.0);
+        std::size_t i = begin;
+        while(i < end)
+        {
+            const std::size_t e = mExponents[i*Dimension + k];
+
+            std::size_t j = i + 1;
+            while((j < end) && (mExponents[j*Dimension + k] == e))
+                ++j;
+
+            Result += Horner<TValueType>(k+1, i, j, X);
+
+            const std::size_t e_next = (j < end) ? mExponents[j*Dimension + k] : 0;
+            if(e > e_next)
+                Result = Result * IntegerPow(X[k], e - e_next);
+
+            i = j;
+        }
+
+        return Result;
+    }
+
+
+    /// Compute x^n by repeated squaring
+    template<typename TValueType>
+    static TValueType IntegerPow(const TValueType& x, std::size_t n)
+    {
+        TValueType Result(1.0);
+        TValueType b(x);
+        while(true)
+        {
+            if(n & 1)
+                Result = Result * b;
+            n >>= 1;
+            if(n == 0)
+                break;
+            b = b * b;
+        }
+        return Result;
+    }
+
+
+    /// Compare the exponents of two terms lexicographically, with the higher exponents first
+    static int CompareExponents(const std::size_t* e1, const std::size_t* e2)
+    {
+        for(std::size_t k = 0; k < Dimension; ++k)
+        {
+            if(e1[k] > e2[k])
+                return -1;
+            else if(e1[k] < e2[k])
+                return 1;
+        }
+        return 0;
+    }
+
+
+    static std::string VariableName(const std::size_t& k)
+    {
+        if(Dimension == 1)
+            return "t";
+        const char* names[] = {"x", "y", "z"};
+        if(k < 3)
+            return names[k];
+        std::stringstream ss;
+        ss << "x" << k;
+        return ss.str();
+    }
+
+
+    ///@}
+    ///@name Private  Access
+    ///@{
+
+
+    ///@}
+    ///@name Private Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Un accessible methods
+    ///@{
+
+    /// Assignment operator.
+    PolynomialFunction& operator=(PolynomialFunction const& rOther);
+
+    ///@}
+
+}; // Class PolynomialFunction
+
+template<class TFunction>
+const std::size_t PolynomialFunction<TFunction>::Dimension;
+
+///@}
+
+///@name Type Definitions
+///@{
+
+
+///@}
+///@name Input and output
+///@{
+
+
+/// input stream PolynomialFunction
+template<class TFunction>
+inline std::istream& operator >> (std::istream& rIStream, PolynomialFunction<TFunction>& rThis)
+{}
+
+/// output stream PolynomialFunction
+template<class TFunction>
+inline std::ostream& operator << (std::ostream& rOStream, const PolynomialFunction<TFunction>& rThis)
+{
+    rThis.PrintInfo(rOStream);
+    rOStream << std::endl;
+    rThis.PrintData(rOStream);
+
+    return rOStream;
+}
+///@}
+
+///@} addtogroup block
+
+}  // namespace Kratos.
+
+#endif // KRATOS_POLYNOMIAL_FUNCTION_H_INCLUDED  defined
@@ -28,6 +28,7 @@
 // Project includes
 #include "includes/define.h"
 #include "custom_algebra/function/function.h"
+#include "custom_algebra/function/scalar_function.h"
 
 
 namespace Kratos
@@ -87,6 +88,10 @@ public:
     : BaseType(), ma(a), mp_func(p_func)
     {}
 
+    /// Default constructor, only used by the serializer.
+    PowFunction() : BaseType(), ma(0.0)
+    {}
+
     /// Copy constructor.
     PowFunction(PowFunction const& rOther)
     : BaseType(rOther), mp_func(rOther.mp_func->CloneFunction()), ma(rOther.ma)
@@ -119,6 +124,76 @@ public:
     }
 
 
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        mp_func->GetValues(P, n, Values);
+        if(ma == 2.0)
+        {
+            for(std::size_t i = 0; i < n; ++i)
+                Values[i] *= Values[i];
+        }
+        else
+        {
+            for(std::size_t i = 0; i < n; ++i)
+                Values[i] = pow(Values[i], ma);
+        }
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        if(ma == 0.0)
+            return rTape.AddConstant(1.0);
+
+        if((ma > 0.0) && (ma <= 64.0) && (floor(ma) == ma))
+            return rTape.AddUnary(FunctionTape<InputType, OutputType>::INTEGER_POW, mp_func->Compile(rTape), ma);
+
+        return rTape.AddUnary(FunctionTape<InputType, OutputType>::POW, mp_func->Compile(rTape), ma);
+    }
+
+
+    virtual typename BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        return pow(mp_func->GetDualValue(P), ma);
+    }
+
+
+    virtual typename BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        return pow(mp_func->GetGradientDualValue(P), ma);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return mp_func->HasDualValue();
+    }
+
+
+    virtual typename BaseType::Pointer SimplifyFunction(typename BaseType::SimplifyData& rData) const
+    {
+        if(ma == 0.0)
+            return ConstantFunctionFactory<BaseType>::Create(rData, 1.0);
+
+        typename BaseType::Pointer p = mp_func->Simplify(rData);
+
+        if(ma == 1.0)
+            return p;
+
+        OutputType v;
+        if(p->IsConstant(v))
+            return ConstantFunctionFactory<BaseType>::Create(rData, pow(v, ma));
+
+        // (f^a)^b = f^(a*b) is only merged for integer exponents
+        const PowFunction* pPow = dynamic_cast<const PowFunction*>(p.get());
+        if((pPow != NULL) && (floor(ma) == ma) && (floor(pPow->ma) == pPow->ma))
+            return PowFunction(ma*pPow->ma, pPow->mp_func).SimplifyFunction(rData);
+
+        return BaseType::ShareFunction(rData, BaseType::SimplifyKey("Pow", p.get(), NULL, ma),
+                typename BaseType::Pointer(new PowFunction(ma, p)));
+    }
+
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         std::stringstream ss;
@@ -241,7 +316,7 @@ private:
     ///@{
 
     double ma;
-    const typename BaseType::Pointer mp_func;
+    typename BaseType::Pointer mp_func;
 
     ///@}
     ///@name Private Operators
@@ -252,6 +327,21 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("a", ma);
+        rSerializer.save("Function", mp_func);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("a", ma);
+        rSerializer.load("Function", mp_func);
+    }
 
     ///@}
     ///@name Private  Access
@@ -29,6 +29,8 @@
 #include "includes/define.h"
 #include "custom_algebra/function/function.h"
 #include "custom_algebra/function/sum_function.h"
+#include "custom_algebra/function/scale_function.h"
+#include "custom_algebra/function/scalar_function.h"
 #include "custom_algebra/function/product_function.h"
 
 
@@ -85,6 +87,10 @@ public:
     : BaseType(), mp_func_1(p_func_1), mp_func_2(p_func_2)
     {}
 
+    /// Default constructor, only used by the serializer.
+    ProductFunction() : BaseType()
+    {}
+
     /// Copy constructor.
     ProductFunction(ProductFunction const& rOther)
     : BaseType(rOther)
@@ -119,6 +125,66 @@ public:
     }
 
 
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        std::vector<OutputType> Values2(n);
+        mp_func_1->GetValues(P, n, Values);
+        mp_func_2->GetValues(P, n, &Values2[0]);
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] *= Values2[i];
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        return rTape.AddBinary(FunctionTape<InputType, OutputType>::MULTIPLY, mp_func_1->Compile(rTape), mp_func_2->Compile(rTape));
+    }
+
+
+    virtual typename BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        return mp_func_1->GetDualValue(P) * mp_func_2->GetDualValue(P);
+    }
+
+
+    virtual typename BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        return mp_func_1->GetGradientDualValue(P) * mp_func_2->GetGradientDualValue(P);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return mp_func_1->HasDualValue() && mp_func_2->HasDualValue();
+    }
+
+
+    virtual typename BaseType::Pointer SimplifyFunction(typename BaseType::SimplifyData& rData) const
+    {
+        typename BaseType::Pointer p1 = mp_func_1->Simplify(rData);
+        typename BaseType::Pointer p2 = mp_func_2->Simplify(rData);
+
+        OutputType v1, v2;
+        const bool is_constant_1 = p1->IsConstant(v1);
+        const bool is_constant_2 = p2->IsConstant(v2);
+
+        if(is_constant_1 && is_constant_2)
+            return ConstantFunctionFactory<BaseType>::Create(rData, v1 * v2);
+        if((is_constant_1 && (v1 == 0.0)) || (is_constant_2 && (v2 == 0.0)))
+            return ConstantFunctionFactory<BaseType>::CreateZero(rData);
+        if(is_constant_1)
+            return ScaleFunction<BaseType>(v1, p2).SimplifyFunction(rData);
+        if(is_constant_2)
+            return ScaleFunction<BaseType>(v2, p1).SimplifyFunction(rData);
+
+        // the operands are ordered to share a*b and b*a
+        if(p2.get() < p1.get())
+            std::swap(p1, p2);
+        return BaseType::ShareFunction(rData, BaseType::SimplifyKey("Product", p1.get(), p2.get(), 0.0),
+                typename BaseType::Pointer(new ProductFunction(p1, p2)));
+    }
+
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return mp_func_1->GetFormula(Format) + "*" + mp_func_2->GetFormula(Format);
@@ -231,8 +297,8 @@ private:
     ///@name Member Variables
     ///@{
 
-    const typename BaseType::Pointer mp_func_1;
-    const typename BaseType::Pointer mp_func_2;
+    typename BaseType::Pointer mp_func_1;
+    typename BaseType::Pointer mp_func_2;
 
     ///@}
     ///@name Private Operators
@@ -243,6 +309,21 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("Function1", mp_func_1);
+        rSerializer.save("Function2", mp_func_2);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("Function1", mp_func_1);
+        rSerializer.load("Function2", mp_func_2);
+    }
 
     ///@}
     ///@name Private  Access
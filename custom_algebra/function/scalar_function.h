@@ -20,6 +20,7 @@
 // System includes
 #include <string>
 #include <iostream>
+#include <algorithm>
 
 
 // External includes
@@ -28,6 +29,7 @@
 // Project includes
 #include "includes/define.h"
 #include "custom_algebra/function/function.h"
+#include "custom_algebra/function/zero_function.h"
 
 
 namespace Kratos
@@ -83,6 +85,10 @@ public:
     : BaseType(), mS(S)
     {}
 
+    /// Default constructor, only used by the serializer.
+    ScalarFunction() : BaseType(), mS(0.0)
+    {}
+
     /// Copy constructor.
     ScalarFunction(ScalarFunction const& rOther) : BaseType(), mS(rOther.mS)
     {}
@@ -120,6 +126,51 @@ public:
     }
 
 
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        std::fill(Values, Values + n, mS);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        return rTape.AddConstant(mS);
+    }
+
+
+    virtual typename BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        return typename BaseType::DualType(mS);
+    }
+
+
+    virtual typename BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        return typename BaseType::GradientDualType(mS);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual typename BaseType::Pointer SimplifyFunction(typename BaseType::SimplifyData& rData) const
+    {
+        if(mS == 0.0)
+            return BaseType::ShareFunction(rData, "Zero", typename BaseType::Pointer(new ZeroFunction<BaseType>()));
+        return BaseType::ShareFunction(rData, BaseType::SimplifyKey("Scalar", NULL, NULL, mS), this->CloneFunction());
+    }
+
+
+    virtual bool IsConstant(OutputType& rValue) const
+    {
+        rValue = mS;
+        return true;
+    }
+
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         std::stringstream ss;
@@ -219,7 +270,7 @@ private:
     ///@name Member Variables
     ///@{
 
-    const double mS;
+    double mS;
 
     ///@}
     ///@name Private Operators
@@ -230,6 +281,19 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("S", mS);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("S", mS);
+    }
 
     ///@}
     ///@name Private  Access
@@ -263,6 +327,37 @@ private:
 ///@{
 
 
+/// Helper to create the constant function in the simplification. The constant function is only available for the
+/// scalar functions; for the others an empty pointer is returned and the operation shall be kept.
+template<class TFunction, typename TOutputType = typename TFunction::OutputType>
+struct ConstantFunctionFactory
+{
+    static typename TFunction::Pointer Create(typename TFunction::SimplifyData& rData, const TOutputType& value)
+    {
+        return typename TFunction::Pointer();
+    }
+
+    static typename TFunction::Pointer CreateZero(typename TFunction::SimplifyData& rData)
+    {
+        return typename TFunction::Pointer();
+    }
+};
+
+template<class TFunction>
+struct ConstantFunctionFactory<TFunction, double>
+{
+    static typename TFunction::Pointer Create(typename TFunction::SimplifyData& rData, const double& value)
+    {
+        return ScalarFunction<TFunction>(value).SimplifyFunction(rData);
+    }
+
+    static typename TFunction::Pointer CreateZero(typename TFunction::SimplifyData& rData)
+    {
+        return Create(rData, 0.0);
+    }
+};
+
+
 /// input stream ScalarFunction
 template<class TFunction>
 inline std::istream& operator >> (std::istream& rIStream, ScalarFunction<TFunction>& rThis)
@@ -28,6 +28,7 @@
 // Project includes
 #include "includes/define.h"
 #include "custom_algebra/function/function.h"
+#include "custom_algebra/function/scalar_function.h"
 
 
 namespace Kratos
@@ -83,6 +84,10 @@ public:
     : BaseType(), ma(a), mp_func(p_func)
     {}
 
+    /// Default constructor, only used by the serializer.
+    ScaleFunction() : BaseType(), ma(0.0)
+    {}
+
     /// Copy constructor.
     ScaleFunction(ScaleFunction const& rOther)
     : BaseType(rOther), ma(rOther.ma), mp_func(rOther.mp_func->CloneFunction())
@@ -115,6 +120,64 @@ public:
     }
 
 
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        mp_func->GetValues(P, n, Values);
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] *= ma;
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        return rTape.AddUnary(FunctionTape<InputType, OutputType>::SCALE, mp_func->Compile(rTape), ma);
+    }
+
+
+    virtual typename BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        return ma*mp_func->GetDualValue(P);
+    }
+
+
+    virtual typename BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        return ma*mp_func->GetGradientDualValue(P);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return mp_func->HasDualValue();
+    }
+
+
+    virtual typename BaseType::Pointer SimplifyFunction(typename BaseType::SimplifyData& rData) const
+    {
+        typename BaseType::Pointer p = mp_func->Simplify(rData);
+
+        if(ma == 1.0)
+            return p;
+
+        typename BaseType::Pointer pConstant;
+        OutputType v;
+        if(ma == 0.0)
+            pConstant = ConstantFunctionFactory<BaseType>::CreateZero(rData);
+        else if(p->IsConstant(v))
+            pConstant = ConstantFunctionFactory<BaseType>::Create(rData, ma*v);
+        if(pConstant != NULL)
+            return pConstant;
+
+        // merge the nested scales
+        const ScaleFunction* pScale = dynamic_cast<const ScaleFunction*>(p.get());
+        if(pScale != NULL)
+            return ScaleFunction(ma*pScale->ma, pScale->mp_func).SimplifyFunction(rData);
+
+        return BaseType::ShareFunction(rData, BaseType::SimplifyKey("Scale", p.get(), NULL, ma),
+                typename BaseType::Pointer(new ScaleFunction(ma, p)));
+    }
+
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         std::stringstream ss;
@@ -217,7 +280,7 @@ private:
     ///@{
 
     double ma;
-    const typename BaseType::Pointer mp_func;
+    typename BaseType::Pointer mp_func;
 
     ///@}
     ///@name Private Operators
@@ -228,6 +291,21 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("a", ma);
+        rSerializer.save("Function", mp_func);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("a", ma);
+        rSerializer.load("Function", mp_func);
+    }
 
     ///@}
     ///@name Private  Access
@@ -27,6 +27,8 @@
 // Project includes
 #include "includes/define.h"
 #include "custom_algebra/function/function.h"
+#include "custom_algebra/function/scale_function.h"
+#include "custom_algebra/function/scalar_function.h"
 
 
 namespace Kratos
@@ -82,6 +84,10 @@ public:
     : BaseType(), mp_func_1(p_func_1), mp_func_2(p_func_2)
     {}
 
+    /// Default constructor, only used by the serializer.
+    SumFunction() : BaseType()
+    {}
+
     /// Copy constructor.
     SumFunction(SumFunction const& rOther)
     : BaseType(rOther)
@@ -116,6 +122,66 @@ public:
     }
 
 
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        std::vector<OutputType> Values2(n);
+        mp_func_1->GetValues(P, n, Values);
+        mp_func_2->GetValues(P, n, &Values2[0]);
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] += Values2[i];
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        return rTape.AddBinary(FunctionTape<InputType, OutputType>::ADD, mp_func_1->Compile(rTape), mp_func_2->Compile(rTape));
+    }
+
+
+    virtual typename BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        return mp_func_1->GetDualValue(P) + mp_func_2->GetDualValue(P);
+    }
+
+
+    virtual typename BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        return mp_func_1->GetGradientDualValue(P) + mp_func_2->GetGradientDualValue(P);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return mp_func_1->HasDualValue() && mp_func_2->HasDualValue();
+    }
+
+
+    virtual typename BaseType::Pointer SimplifyFunction(typename BaseType::SimplifyData& rData) const
+    {
+        typename BaseType::Pointer p1 = mp_func_1->Simplify(rData);
+        typename BaseType::Pointer p2 = mp_func_2->Simplify(rData);
+
+        OutputType v1, v2;
+        const bool is_constant_1 = p1->IsConstant(v1);
+        const bool is_constant_2 = p2->IsConstant(v2);
+
+        if(is_constant_1 && is_constant_2)
+            return ConstantFunctionFactory<BaseType>::Create(rData, v1 + v2);
+        if(is_constant_1 && (v1 == 0.0))
+            return p2;
+        if(is_constant_2 && (v2 == 0.0))
+            return p1;
+        if(p1 == p2)
+            return ScaleFunction<BaseType>(2.0, p1).SimplifyFunction(rData);
+
+        // the operands are ordered to share a+b and b+a
+        if(p2.get() < p1.get())
+            std::swap(p1, p2);
+        return BaseType::ShareFunction(rData, BaseType::SimplifyKey("Sum", p1.get(), p2.get(), 0.0),
+                typename BaseType::Pointer(new SumFunction(p1, p2)));
+    }
+
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return mp_func_1->GetFormula(Format) + "+" + mp_func_2->GetFormula(Format);
@@ -218,8 +284,8 @@ private:
     ///@name Member Variables
     ///@{
 
-    const typename BaseType::Pointer mp_func_1;
-    const typename BaseType::Pointer mp_func_2;
+    typename BaseType::Pointer mp_func_1;
+    typename BaseType::Pointer mp_func_2;
 
     ///@}
     ///@name Private Operators
@@ -230,6 +296,21 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("Function1", mp_func_1);
+        rSerializer.save("Function2", mp_func_2);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("Function1", mp_func_1);
+        rSerializer.load("Function2", mp_func_2);
+    }
 
     ///@}
     ///@name Private  Access
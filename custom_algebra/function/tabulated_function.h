@@ -0,0 +1,624 @@
+//    |  /           |
+//    ' /   __| _` | __|  _ \   __|
+//    . \  |   (   | |   (   |\__ `
+//   _|\_\_|  \__,_|\__|\___/ ____/
+//                   Multi-Physics
+//
+//  License:         brep_application/LICENSE.txt
+//                   Kratos default license: kratos/license.txt
+//
+//  Main authors:    Hoang-Giang Bui
+//  Date:            16 Oct 2026
+//
+
+
+#if !defined(KRATOS_TABULATED_FUNCTION_H_INCLUDED )
+#define  KRATOS_TABULATED_FUNCTION_H_INCLUDED
+
+
+
+// System includes
+#include <cmath>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+
+
+// External includes
+#include <boost/shared_ptr.hpp>
+
+
+// Project includes
+#include "includes/define.h"
+#include "custom_algebra/function/function.h"
+
+
+namespace Kratos
+{
+///@addtogroup BRepApplication
+///@{
+
+///@name Kratos Globals
+///@{
+
+///@}
+///@name Type Definitions
+///@{
+
+/// Traits of the output of a tabulated function. The dual numbers are only available for the scalar output.
+template<typename TOutputType>
+struct TabulatedFunctionOutputTraits
+{
+    static const bool HasDualValue = false;
+};
+
+template<>
+struct TabulatedFunctionOutputTraits<double>
+{
+    static const bool HasDualValue = true;
+};
+
+///@}
+///@name  Enum's
+///@{
+
+///@}
+///@name  Functions
+///@{
+
+///@}
+///@name Kratos Classes
+///@{
+
+/// Short class definition.
+/** Class for a function of one variable which is sampled once on an interval, together with its derivative, and then
+ * evaluated by piecewise cubic Hermite interpolation. The samples are uniform, or refined adaptively until the interpolation
+ * error at the middle of each interval is below a tolerance. Outside of the interval the end pieces are extrapolated.
+ * The table is shared between the clones.
+*/
+template<class TFunction>
+class TabulatedFunction : public TFunction
+{
+public:
+    ///@name Type Definitions
+    ///@{
+
+    /// Pointer definition of TabulatedFunction
+    KRATOS_CLASS_POINTER_DEFINITION(TabulatedFunction);
+
+    typedef TFunction BaseType;
+
+    typedef typename BaseType::InputType InputType;
+
+    typedef typename BaseType::OutputType OutputType;
+
+    typedef typename BaseType::DualType DualType;
+
+    typedef typename BaseType::GradientDualType GradientDualType;
+
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// Constructor with uniform sampling.
+    TabulatedFunction(const typename BaseType::Pointer p_func, const double& tmin, const double& tmax, const std::size_t& nsampling)
+    : BaseType(), mp_func(p_func), mTolerance(0.0)
+    {
+        this->Tabulate(tmin, tmax, nsampling);
+    }
+
+    /// Constructor with adaptive sampling. The uniform samples are refined until the error is below the tolerance.
+    TabulatedFunction(const typename BaseType::Pointer p_func, const double& tmin, const double& tmax, const std::size_t& nsampling,
+            const double& tolerance)
+    : BaseType(), mp_func(p_func), mTolerance(tolerance)
+    {
+        this->Tabulate(tmin, tmax, nsampling);
+    }
+
+    /// Default constructor, only used by the serializer.
+    TabulatedFunction() : BaseType(), mTolerance(0.0), mNumberOfInitialSamples(0)
+    {}
+
+    /// Copy constructor.
+    TabulatedFunction(TabulatedFunction const& rOther)
+    : BaseType(rOther), mp_func(rOther.mp_func->CloneFunction())
+    , mTolerance(rOther.mTolerance), mNumberOfInitialSamples(rOther.mNumberOfInitialSamples)
+    , mpTable(rOther.mpTable)
+    {}
+
+    /// Destructor.
+    virtual ~TabulatedFunction()
+    {}
+
+
+    ///@}
+    ///@name Operators
+    ///@{
+
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+
+    virtual typename BaseType::Pointer CloneFunction() const
+    {
+        return typename BaseType::Pointer(new TabulatedFunction(*this));
+    }
+
+
+    virtual OutputType GetValue(const InputType& t) const
+    {
+        OutputType f;
+        this->Interpolate(this->FindInterval(t), t, &f, NULL, NULL);
+        return f;
+    }
+
+
+    virtual OutputType GetDerivative(const int& component, const InputType& t) const
+    {
+        OutputType df;
+        this->Interpolate(this->FindInterval(t), t, NULL, &df, NULL);
+        return df;
+    }
+
+
+    virtual OutputType GetSecondDerivative(const int& component_1, const int& component_2, const InputType& t) const
+    {
+        OutputType ddf;
+        this->Interpolate(this->FindInterval(t), t, NULL, NULL, &ddf);
+        return ddf;
+    }
+
+
+    virtual DualType GetDualValue(const InputType& t) const
+    {
+        OutputType f, df, ddf;
+        this->Interpolate(this->FindInterval(t), t, &f, &df, &ddf);
+        return ToDual(t, f, df, ddf);
+    }
+
+
+    virtual GradientDualType GetGradientDualValue(const InputType& t) const
+    {
+        OutputType f, df;
+        this->Interpolate(this->FindInterval(t), t, &f, &df, NULL);
+        return ToGradientDual(t, f, df);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return TabulatedFunctionOutputTraits<OutputType>::HasDualValue;
+    }
+
+
+    virtual void GetValues(const InputType* t, const std::size_t n, OutputType* Values) const
+    {
+        this->GetValuesAndDerivatives(t, n, Values, NULL, NULL);
+    }
+
+
+    /// Evaluate at a batch of parameters. If the parameters are sorted, the intervals are walked instead of searched.
+    virtual void GetValuesAndDerivatives(const InputType* t, const std::size_t n, OutputType* Values,
+            OutputType* Derivatives, OutputType* SecondDerivatives) const
+    {
+        if(n == 0)
+            return;
+
+        const std::vector<double>& T = mpTable->T;
+        std::size_t i = this->FindInterval(t[0]);
+        for(std::size_t k = 0; k < n; ++k)
+        {
+            if(k > 0)
+            {
+                if(t[k] < t[k-1])
+                    i = this->FindInterval(t[k]);
+                else
+                    while((i+2 < T.size()) && (T[i+1] <= t[k]))
+                        ++i;
+            }
+
+            this->Interpolate(i, t[k], (Values != NULL) ? &Values[k] : NULL,
+                    (Derivatives != NULL) ? &Derivatives[k] : NULL,
+                    (SecondDerivatives != NULL) ? &SecondDerivatives[k] : NULL);
+        }
+    }
+
+
+    /// The derivative is tabulated from the derivative of the original function with the same sampling
+    virtual typename BaseType::Pointer GetDiffFunction(const int& component) const
+    {
+        const std::vector<double>& T = mpTable->T;
+        if(mTolerance > 0.0)
+            return typename BaseType::Pointer(new TabulatedFunction(mp_func->GetDiffFunction(component),
+                    T.front(), T.back(), mNumberOfInitialSamples, mTolerance));
+        return typename BaseType::Pointer(new TabulatedFunction(mp_func->GetDiffFunction(component),
+                T.front(), T.back(), mNumberOfInitialSamples));
+    }
+
+
+    virtual std::string GetFormula(const std::string& Format) const
+    {
+        return mp_func->GetFormula(Format);
+    }
+
+
+    ///@}
+    ///@name Access
+    ///@{
+
+
+    /// Get the number of samples in the table
+    std::size_t NumberOfSamples() const
+    {
+        return mpTable->T.size();
+    }
+
+
+    ///@}
+    ///@name Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Input and output
+    ///@{
+
+    /// Turn back information as a string.
+    virtual std::string Info() const
+    {
+        return "Tabulated Function of " + mp_func->Info();
+    }
+
+    /// Print information about this object.
+    virtual void PrintInfo(std::ostream& rOStream) const
+    {
+        rOStream << Info();
+    }
+
+    /// Print object's data.
+    virtual void PrintData(std::ostream& rOStream) const
+    {
+        rOStream << " Interval: [" << mpTable->T.front() << ", " << mpTable->T.back() << "]" << std::endl;
+        rOStream << " Number of samples: " << mpTable->T.size();
+        if(mTolerance > 0.0)
+            rOStream << ", tolerance: " << mTolerance;
+    }
+
+
+    ///@}
+    ///@name Friends
+    ///@{
+
+
+    ///@}
+
+protected:
+    ///@name Protected static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Protected member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Protected Operators
+    ///@{
+
+
+    ///@}
+    ///@name Protected Operations
+    ///@{
+
+
+    ///@}
+    ///@name Protected  Access
+    ///@{
+
+
+    ///@}
+    ///@name Protected Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Protected LifeCycle
+    ///@{
+
+
+    ///@}
+
+private:
+    ///@name Static Member Variables
+    ///@{
+
+    /// Maximum number of bisections of an initial interval in the adaptive sampling
+    static const int msMaxRefinementLevel = 20;
+
+    ///@}
+    ///@name Member Variables
+    ///@{
+
+    /// The samples and the derivatives at the samples
+    struct Table
+    {
+        std::vector<double> T;
+        std::vector<OutputType> F;
+        std::vector<OutputType> DF;
+        bool IsUniform;
+    };
+
+    typename BaseType::Pointer mp_func;
+    double mTolerance;
+    std::size_t mNumberOfInitialSamples;
+    boost::shared_ptr<const Table> mpTable;
+
+    ///@}
+    ///@name Private Operators
+    ///@{
+
+
+    ///@}
+    ///@name Private Operations
+    ///@{
+
+    friend class Serializer;
+
+    /// The table is saved, hence the function is not sampled again when it is loaded
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("Function", mp_func);
+        rSerializer.save("Tolerance", mTolerance);
+        rSerializer.save("NumberOfInitialSamples", mNumberOfInitialSamples);
+        rSerializer.save("T", mpTable->T);
+        rSerializer.save("F", mpTable->F);
+        rSerializer.save("DF", mpTable->DF);
+        rSerializer.save("IsUniform", mpTable->IsUniform);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("Function", mp_func);
+        rSerializer.load("Tolerance", mTolerance);
+        rSerializer.load("NumberOfInitialSamples", mNumberOfInitialSamples);
+        boost::shared_ptr<Table> pTable(new Table());
+        rSerializer.load("T", pTable->T);
+        rSerializer.load("F", pTable->F);
+        rSerializer.load("DF", pTable->DF);
+        rSerializer.load("IsUniform", pTable->IsUniform);
+        mpTable = pTable;
+    }
+
+
+    /// Sample the function on [tmin, tmax]
+    void Tabulate(const double& tmin, const double& tmax, const std::size_t& nsampling)
+    {
+        if(nsampling < 2)
+            KRATOS_THROW_ERROR(std::logic_error, "The number of samples must be at least 2, given:", nsampling)
+
+        if(!(tmax > tmin))
+            KRATOS_THROW_ERROR(std::logic_error, "The interval is empty, tmax =", tmax)
+
+        mNumberOfInitialSamples = nsampling;
+
+        boost::shared_ptr<Table> pTable(new Table());
+        pTable->IsUniform = !(mTolerance > 0.0);
+
+        double t0 = tmin;
+        OutputType f0 = mp_func->GetValue(t0);
+        OutputType df0 = mp_func->GetDerivative(0, t0);
+        this->AddSample(*pTable, t0, f0, df0);
+
+        for(std::size_t i = 1; i < nsampling; ++i)
+        {
+            const double t1 = (i == nsampling-1) ? tmax : tmin + i*(tmax-tmin)/(nsampling-1);
+            const OutputType f1 = mp_func->GetValue(t1);
+            const OutputType df1 = mp_func->GetDerivative(0, t1);
+
+            if(mTolerance > 0.0)
+                this->Refine(*pTable, t0, f0, df0, t1, f1, df1, 0);
+
+            this->AddSample(*pTable, t1, f1, df1);
+
+            t0 = t1;
+            f0 = f1;
+            df0 = df1;
+        }
+
+        mpTable = pTable;
+    }
+
+
+    /// Add the samples inside (t0, t1) until the interpolation error at the middle is below the tolerance
+    void Refine(Table& rTable, const double& t0, const OutputType& f0, const OutputType& df0,
+            const double& t1, const OutputType& f1, const OutputType& df1, const int level) const
+    {
+        if(level >= msMaxRefinementLevel)
+            return;
+
+        const double tm = 0.5*(t0 + t1);
+        const OutputType fm = mp_func->GetValue(tm);
+
+        // the Hermite interpolation at the middle of the interval
+        const double h = t1 - t0;
+        OutputType fi = 0.5*f0;
+        fi += 0.5*f1;
+        fi += (0.125*h)*df0;
+        fi -= (0.125*h)*df1;
+        fi -= fm;
+        if(ErrorNorm(fi) <= mTolerance)
+            return;
+
+        const OutputType dfm = mp_func->GetDerivative(0, tm);
+        this->Refine(rTable, t0, f0, df0, tm, fm, dfm, level+1);
+        this->AddSample(rTable, tm, fm, dfm);
+        this->Refine(rTable, tm, fm, dfm, t1, f1, df1, level+1);
+    }
+
+
+    static void AddSample(Table& rTable, const double& t, const OutputType& f, const OutputType& df)
+    {
+        rTable.T.push_back(t);
+        rTable.F.push_back(f);
+        rTable.DF.push_back(df);
+    }
+
+
+    /// Find the interval containing t. The parameters outside of the table are assigned to the end intervals.
+    std::size_t FindInterval(const double& t) const
+    {
+        const std::vector<double>& T = mpTable->T;
+        const std::size_t n = T.size();
+
+        if(mpTable->IsUniform)
+        {
+            const double s = (t - T[0]) / (T[1] - T[0]);
+            if(!(s > 0.0))
+                return 0;
+            return std::min(static_cast<std::size_t>(s), n-2);
+        }
+
+        const std::size_t i = std::upper_bound(T.begin(), T.end(), t) - T.begin();
+        if(i == 0)
+            return 0;
+        return std::min(i-1, n-2);
+    }
+
+
+    /// Evaluate the cubic Hermite interpolation on the interval i. Any of the outputs can be NULL.
+    void Interpolate(const std::size_t& i, const double& t, OutputType* f, OutputType* df, OutputType* ddf) const
+    {
+        const Table& rTable = *mpTable;
+        const double h = rTable.T[i+1] - rTable.T[i];
+        const double s = (t - rTable.T[i]) / h;
+        const double s2 = s*s;
+        const double s3 = s2*s;
+
+        const OutputType& f0 = rTable.F[i];
+        const OutputType& f1 = rTable.F[i+1];
+        const OutputType& m0 = rTable.DF[i];
+        const OutputType& m1 = rTable.DF[i+1];
+
+        if(f != NULL)
+        {
+            *f = (2.0*s3 - 3.0*s2 + 1.0)*f0;
+            *f += (-2.0*s3 + 3.0*s2)*f1;
+            *f += ((s3 - 2.0*s2 + s)*h)*m0;
+            *f += ((s3 - s2)*h)*m1;
+        }
+
+        if(df != NULL)
+        {
+            *df = ((6.0*s2 - 6.0*s)/h)*f0;
+            *df += ((-6.0*s2 + 6.0*s)/h)*f1;
+            *df += (3.0*s2 - 4.0*s + 1.0)*m0;
+            *df += (3.0*s2 - 2.0*s)*m1;
+        }
+
+        if(ddf != NULL)
+        {
+            *ddf = ((12.0*s - 6.0)/(h*h))*f0;
+            *ddf += ((-12.0*s + 6.0)/(h*h))*f1;
+            *ddf += ((6.0*s - 4.0)/h)*m0;
+            *ddf += ((6.0*s - 2.0)/h)*m1;
+        }
+    }
+
+
+    static double ErrorNorm(const double& v)
+    {
+        return std::abs(v);
+    }
+
+    static double ErrorNorm(const array_1d<double, 3>& v)
+    {
+        return norm_2(v);
+    }
+
+
+    static DualType ToDual(const double& t, const double& f, const double& df, const double& ddf)
+    {
+        return DualType::Variable(t, 0).Compose(f, df, ddf);
+    }
+
+    static DualType ToDual(const double& t, const array_1d<double, 3>& f, const array_1d<double, 3>& df, const array_1d<double, 3>& ddf)
+    {
+        KRATOS_THROW_ERROR(std::logic_error, "The dual number is only available for the scalar functions", "")
+    }
+
+    static GradientDualType ToGradientDual(const double& t, const double& f, const double& df)
+    {
+        return GradientDualType::Variable(t, 0).Compose(f, df, 0.0);
+    }
+
+    static GradientDualType ToGradientDual(const double& t, const array_1d<double, 3>& f, const array_1d<double, 3>& df)
+    {
+        KRATOS_THROW_ERROR(std::logic_error, "The dual number is only available for the scalar functions", "")
+    }
+
+
+    ///@}
+    ///@name Private  Access
+    ///@{
+
+
+    ///@}
+    ///@name Private Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Un accessible methods
+    ///@{
+
+    /// Assignment operator.
+    TabulatedFunction& operator=(TabulatedFunction const& rOther);
+
+    ///@}
+
+}; // Class TabulatedFunction
+
+template<class TFunction>
+const int TabulatedFunction<TFunction>::msMaxRefinementLevel;
+
+///@}
+
+///@name Type Definitions
+///@{
+
+
+///@}
+///@name Input and output
+///@{
+
+
+/// input stream TabulatedFunction
+template<class TFunction>
+inline std::istream& operator >> (std::istream& rIStream, TabulatedFunction<TFunction>& rThis)
+{}
+
+/// output stream TabulatedFunction
+template<class TFunction>
+inline std::ostream& operator << (std::ostream& rOStream, const TabulatedFunction<TFunction>& rThis)
+{
+    rThis.PrintInfo(rOStream);
+    rOStream << std::endl;
+    rThis.PrintData(rOStream);
+
+    return rOStream;
+}
+///@}
+
+///@} addtogroup block
+
+}  // namespace Kratos.
+
+#endif // KRATOS_TABULATED_FUNCTION_H_INCLUDED  defined
@@ -86,6 +86,10 @@ public:
     : BaseType(), mp_func(p_func)
     {}
 
+    /// Default constructor, only used by the serializer.
+    CosFunction() : BaseType()
+    {}
+
     /// Copy constructor.
     CosFunction(CosFunction const& rOther)
     : BaseType(rOther), mp_func(rOther.mp_func->CloneFunction())
@@ -118,6 +122,51 @@ public:
     }
 
 
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        mp_func->GetValues(P, n, Values);
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = cos(Values[i]);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        return rTape.AddUnary(FunctionTape<InputType, OutputType>::COS, mp_func->Compile(rTape));
+    }
+
+
+    virtual typename BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        return cos(mp_func->GetDualValue(P));
+    }
+
+
+    virtual typename BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        return cos(mp_func->GetGradientDualValue(P));
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return mp_func->HasDualValue();
+    }
+
+
+    virtual typename BaseType::Pointer SimplifyFunction(typename BaseType::SimplifyData& rData) const
+    {
+        typename BaseType::Pointer p = mp_func->Simplify(rData);
+
+        OutputType v;
+        if(p->IsConstant(v))
+            return ConstantFunctionFactory<BaseType>::Create(rData, cos(v));
+
+        return BaseType::ShareFunction(rData, BaseType::SimplifyKey("Cos", p.get(), NULL, 0.0),
+                typename BaseType::Pointer(new CosFunction(p)));
+    }
+
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return "cos(" + mp_func->GetFormula(Format) + ")";
@@ -212,7 +261,7 @@ private:
     ///@{
 
 
-    const typename BaseType::Pointer mp_func;
+    typename BaseType::Pointer mp_func;
 
 
     ///@}
@@ -224,6 +273,19 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("Function", mp_func);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("Function", mp_func);
+    }
 
     ///@}
     ///@name Private  Access
@@ -274,6 +336,10 @@ public:
     : BaseType(), mp_func(p_func)
     {}
 
+    /// Default constructor, only used by the serializer.
+    SinFunction() : BaseType()
+    {}
+
     /// Copy constructor.
     SinFunction(SinFunction const& rOther)
     : BaseType(rOther), mp_func(rOther.mp_func->CloneFunction())
@@ -306,6 +372,51 @@ public:
     }
 
 
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        mp_func->GetValues(P, n, Values);
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = sin(Values[i]);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        return rTape.AddUnary(FunctionTape<InputType, OutputType>::SIN, mp_func->Compile(rTape));
+    }
+
+
+    virtual typename BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        return sin(mp_func->GetDualValue(P));
+    }
+
+
+    virtual typename BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        return sin(mp_func->GetGradientDualValue(P));
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return mp_func->HasDualValue();
+    }
+
+
+    virtual typename BaseType::Pointer SimplifyFunction(typename BaseType::SimplifyData& rData) const
+    {
+        typename BaseType::Pointer p = mp_func->Simplify(rData);
+
+        OutputType v;
+        if(p->IsConstant(v))
+            return ConstantFunctionFactory<BaseType>::Create(rData, sin(v));
+
+        return BaseType::ShareFunction(rData, BaseType::SimplifyKey("Sin", p.get(), NULL, 0.0),
+                typename BaseType::Pointer(new SinFunction(p)));
+    }
+
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return "sin(" + mp_func->GetFormula(Format) + ")";
@@ -401,7 +512,7 @@ private:
     ///@{
 
 
-    const typename BaseType::Pointer mp_func;
+    typename BaseType::Pointer mp_func;
 
 
     ///@}
@@ -413,6 +524,19 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("Function", mp_func);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("Function", mp_func);
+    }
 
     ///@}
     ///@name Private  Access
@@ -463,6 +587,10 @@ public:
     : BaseType(), mp_func(p_func)
     {}
 
+    /// Default constructor, only used by the serializer.
+    AcosFunction() : BaseType()
+    {}
+
     /// Copy constructor.
     AcosFunction(AcosFunction const& rOther)
     : BaseType(rOther), mp_func(rOther.mp_func->CloneFunction())
@@ -495,6 +623,51 @@ public:
     }
 
 
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        mp_func->GetValues(P, n, Values);
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = acos(Values[i]);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        return rTape.AddUnary(FunctionTape<InputType, OutputType>::ACOS, mp_func->Compile(rTape));
+    }
+
+
+    virtual typename BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        return acos(mp_func->GetDualValue(P));
+    }
+
+
+    virtual typename BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        return acos(mp_func->GetGradientDualValue(P));
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return mp_func->HasDualValue();
+    }
+
+
+    virtual typename BaseType::Pointer SimplifyFunction(typename BaseType::SimplifyData& rData) const
+    {
+        typename BaseType::Pointer p = mp_func->Simplify(rData);
+
+        OutputType v;
+        if(p->IsConstant(v))
+            return ConstantFunctionFactory<BaseType>::Create(rData, acos(v));
+
+        return BaseType::ShareFunction(rData, BaseType::SimplifyKey("Acos", p.get(), NULL, 0.0),
+                typename BaseType::Pointer(new AcosFunction(p)));
+    }
+
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return "acos(" + mp_func->GetFormula(Format) + ")";
@@ -590,7 +763,7 @@ private:
     ///@{
 
 
-    const typename BaseType::Pointer mp_func;
+    typename BaseType::Pointer mp_func;
 
 
     ///@}
@@ -602,6 +775,19 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("Function", mp_func);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("Function", mp_func);
+    }
 
     ///@}
     ///@name Private  Access
@@ -20,6 +20,7 @@
 // System includes
 #include <string>
 #include <iostream>
+#include <algorithm>
 
 
 // External includes
@@ -119,6 +120,49 @@ public:
     }
 
 
+    virtual void GetValues(const InputType* P, const std::size_t n, OutputType* Values) const
+    {
+        std::fill(Values, Values + n, 0.0);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        return rTape.AddConstant(0.0);
+    }
+
+
+    virtual typename BaseType::DualType GetDualValue(const InputType& P) const
+    {
+        return typename BaseType::DualType(0.0);
+    }
+
+
+    virtual typename BaseType::GradientDualType GetGradientDualValue(const InputType& P) const
+    {
+        return typename BaseType::GradientDualType(0.0);
+    }
+
+
+    virtual bool HasDualValue() const
+    {
+        return true;
+    }
+
+
+    virtual typename BaseType::Pointer SimplifyFunction(typename BaseType::SimplifyData& rData) const
+    {
+        return BaseType::ShareFunction(rData, "Zero", this->CloneFunction());
+    }
+
+
+    virtual bool IsConstant(OutputType& rValue) const
+    {
+        rValue = 0.0;
+        return true;
+    }
+
+
     virtual std::string GetFormula(const std::string& Format) const
     {
         return "0.0";
@@ -80,6 +80,10 @@ public:
     : BaseType(), mcX(cX), mcY(cY), mR(R)
     {}
 
+    /// Default constructor, only used by the serializer.
+    CircularLevelSet() : BaseType(), mcX(0.0), mcY(0.0), mR(0.0)
+    {}
+
     /// Copy constructor.
     CircularLevelSet(CircularLevelSet const& rOther)
     : BaseType(rOther), mcX(rOther.mcX), mcY(rOther.mcY), mR(rOther.mR)
@@ -111,34 +115,81 @@ public:
     }
 
 
+    /// The circle is extruded along z
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        const double R = std::fabs(mR);
+        rMin[0] = mcX - R; rMax[0] = mcX + R;
+        rMin[1] = mcY - R; rMax[1] = mcY + R;
+        rMin[2] = -std::numeric_limits<double>::infinity();
+        rMax[2] = std::numeric_limits<double>::infinity();
+        return true;
+    }
+
+
     virtual double GetValue(const PointType& P) const
     {
         return pow(P(0) - mcX, 2) + pow(P(1) - mcY, 2) - pow(mR, 2);
     }
 
 
-    virtual Vector GetGradient(const PointType& P) const
+    virtual void GetValues(const PointType* P, const std::size_t n, double* Values) const
+    {
+        const double R2 = mR*mR;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            const double dx = P[i][0] - mcX;
+            const double dy = P[i][1] - mcY;
+            Values[i] = dx*dx + dy*dy - R2;
+        }
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        typedef FunctionTape<InputType, OutputType> TapeType;
+        std::size_t dx = rTape.AddBinary(TapeType::SUBTRACT, rTape.AddVariable(0), rTape.AddConstant(mcX));
+        std::size_t dy = rTape.AddBinary(TapeType::SUBTRACT, rTape.AddVariable(1), rTape.AddConstant(mcY));
+        std::size_t d2 = rTape.AddBinary(TapeType::ADD, rTape.AddUnary(TapeType::SQUARE, dx), rTape.AddUnary(TapeType::SQUARE, dy));
+        return rTape.AddBinary(TapeType::SUBTRACT, d2, rTape.AddConstant(mR*mR));
+    }
+
+
+    virtual void GetGradient(const PointType& P, array_1d<double, 3>& rGradient) const
     {
-        Vector grad(3);
-        grad(0) = 2.0 * (P(0) - mcX);
-        grad(1) = 2.0 * (P(1) - mcY);
-        grad(2) = 0.0;
-        return grad;
+        rGradient[0] = 2.0 * (P(0) - mcX);
+        rGradient[1] = 2.0 * (P(1) - mcY);
+        rGradient[2] = 0.0;
     }
 
 
-    virtual Matrix GetGradientDerivatives(const PointType& P) const
+    virtual void GetGradientDerivatives(const PointType& P, bounded_matrix<double, 3, 3>& rDerivatives) const
     {
-        Matrix Jac(3, 3);
-        noalias(Jac) = ZeroMatrix(3, 3);
+        noalias(rDerivatives) = ZeroMatrix(3, 3);
 
-        Jac(0, 0) = 2.0;
-        Jac(0, 1) = 0.0;
+        rDerivatives(0, 0) = 2.0;
+        rDerivatives(0, 1) = 0.0;
 
-        Jac(1, 0) = 0.0;
-        Jac(1, 1) = 2.0;
+        rDerivatives(1, 0) = 0.0;
+        rDerivatives(1, 1) = 2.0;
+    }
+
+
+    virtual void GetValueGradientHessian(const PointType& P, double& rValue, array_1d<double, 3>& rGradient,
+            bounded_matrix<double, 3, 3>& rHessian) const
+    {
+        const double dx = P(0) - mcX;
+        const double dy = P(1) - mcY;
 
-        return Jac;
+        rValue = dx*dx + dy*dy - mR*mR;
+
+        rGradient[0] = 2.0 * dx;
+        rGradient[1] = 2.0 * dy;
+        rGradient[2] = 0.0;
+
+        noalias(rHessian) = ZeroMatrix(3, 3);
+        rHessian(0, 0) = 2.0;
+        rHessian(1, 1) = 2.0;
     }
 
 
@@ -282,6 +333,15 @@ protected:
     ///@{
 
 
+    /// The gradient is 2(P - c) in the plane, hence its norm is bounded by the distance to the farthest corner of the box
+    virtual double ComputeLipschitzConstant(const PointType& rMin, const PointType& rMax) const
+    {
+        const double a = std::max(std::fabs(rMin[0] - mcX), std::fabs(rMax[0] - mcX));
+        const double b = std::max(std::fabs(rMin[1] - mcY), std::fabs(rMax[1] - mcY));
+        return 2.0*std::sqrt(a*a + b*b);
+    }
+
+
     ///@}
     ///@name Protected  Access
     ///@{
@@ -321,6 +381,23 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("cX", mcX);
+        rSerializer.save("cY", mcY);
+        rSerializer.save("R", mR);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("cX", mcX);
+        rSerializer.load("cY", mcY);
+        rSerializer.load("R", mR);
+    }
 
     ///@}
     ///@name Private  Access
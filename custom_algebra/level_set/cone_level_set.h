@@ -19,6 +19,8 @@
 
 // System includes
 #include <string>
+#include <limits>
+#include <algorithm>
 #include <iostream>
 
 
@@ -58,6 +60,9 @@ namespace Kratos
 
 /// Short class definition.
 /** Detail class definition.
+ * Level set of the double cone with apex c, axis d and half angle phi (in degrees): |r|^2 - (t tan(phi))^2, where t is the
+ * axial coordinate from the apex and r the radial vector. The cone can be truncated to the axial range [tmin, tmax]; the
+ * level set is then the maximum of the cone and of the caps (t - tmin)(t - tmax), and the domain is bounded.
 */
 class ConeLevelSet : public LevelSet
 {
@@ -78,7 +83,7 @@ public:
 
     /// Default constructor.
     ConeLevelSet(const double& cX, const double& cY, const double& cZ, const double& dX, const double& dY, const double& dZ, const double& phi)
-    : BaseType(), mcX(cX), mcY(cY), mcZ(cZ), mphi(phi)
+    : BaseType(), mcX(cX), mcY(cY), mcZ(cZ), mphi(phi), mIsTruncated(false), mtMin(0.0), mtMax(0.0)
     {
         mLength = sqrt(pow(dX, 2) + pow(dY, 2) + pow(dZ, 2));
 
@@ -90,10 +95,16 @@ public:
         mdZ = dZ / mLength;
     }
 
+    /// Default constructor, only used by the serializer.
+    ConeLevelSet() : BaseType(), mcX(0.0), mcY(0.0), mcZ(0.0), mdX(0.0), mdY(0.0), mdZ(0.0), mLength(0.0), mphi(0.0)
+    , mIsTruncated(false), mtMin(0.0), mtMax(0.0)
+    {}
+
     /// Copy constructor.
     ConeLevelSet(ConeLevelSet const& rOther)
     : BaseType(rOther), mcX(rOther.mcX), mcY(rOther.mcY), mcZ(rOther.mcZ)
-    , mdX(rOther.mdX), mdY(rOther.mdY), mdZ(rOther.mdZ), mphi(rOther.mphi)
+    , mdX(rOther.mdX), mdY(rOther.mdY), mdZ(rOther.mdZ), mLength(rOther.mLength), mphi(rOther.mphi)
+    , mIsTruncated(rOther.mIsTruncated), mtMin(rOther.mtMin), mtMax(rOther.mtMax)
     {}
 
     /// Destructor.
@@ -122,6 +133,51 @@ public:
     }
 
 
+    /// Truncate the cone to the axial range [tmin, tmax] of the axial coordinate from the apex
+    void SetAxialRange(const double& tmin, const double& tmax)
+    {
+        if(tmax <= tmin)
+            KRATOS_THROW_ERROR(std::logic_error, "The axial range of the cone is empty", "")
+
+        mIsTruncated = true;
+        mtMin = tmin;
+        mtMax = tmax;
+    }
+
+
+    bool IsTruncated() const
+    {
+        return mIsTruncated;
+    }
+
+
+    /// The truncated cone is bounded by the boxes of its end discs. The extent of the disc at t is linear in t plus
+    /// |t| tan(phi) times a constant, i.e. convex in t, hence its maximum over [tmin, tmax] is at an end disc.
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        if(!mIsTruncated)
+            return false;
+
+        const double c[] = {mcX, mcY, mcZ};
+        const double d[] = {mdX, mdY, mdZ};
+        const double tan_phi = std::fabs(std::tan(mphi*PI/180));
+        const double t[] = {mtMin, mtMax};
+        for(std::size_t i = 0; i < 3; ++i)
+        {
+            const double s = std::sqrt(std::max(0.0, 1.0 - d[i]*d[i]));
+            rMin[i] = std::numeric_limits<double>::infinity();
+            rMax[i] = -std::numeric_limits<double>::infinity();
+            for(std::size_t k = 0; k < 2; ++k)
+            {
+                const double radius = std::fabs(t[k])*tan_phi*s;
+                rMin[i] = std::min(rMin[i], c[i] + t[k]*d[i] - radius);
+                rMax[i] = std::max(rMax[i], c[i] + t[k]*d[i] + radius);
+            }
+        }
+        return true;
+    }
+
+
     virtual double GetValue(const PointType& P) const
     {
         double t = (P(0) - mcX) * mdX + (P(1) - mcY) * mdY + (P(2) - mcZ) * mdZ;
@@ -129,7 +185,53 @@ public:
         double pY = mcY + t*mdY;
         double pZ = mcZ + t*mdZ;
 
-        return pow(P(0) - pX, 2) + pow(P(1) - pY, 2) + pow(P(2) - pZ, 2) - pow(t * std::tan(mphi*PI/180), 2);
+        const double value = pow(P(0) - pX, 2) + pow(P(1) - pY, 2) + pow(P(2) - pZ, 2) - pow(t * std::tan(mphi*PI/180), 2);
+        if(mIsTruncated)
+            return std::max(value, (t - mtMin)*(t - mtMax));
+        return value;
+    }
+
+
+    virtual void GetValues(const PointType* P, const std::size_t n, double* Values) const
+    {
+        const double tan_phi = std::tan(mphi*PI/180);
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            const double dx = P[i][0] - mcX;
+            const double dy = P[i][1] - mcY;
+            const double dz = P[i][2] - mcZ;
+            const double t = dx*mdX + dy*mdY + dz*mdZ;
+            const double rx = dx - t*mdX;
+            const double ry = dy - t*mdY;
+            const double rz = dz - t*mdZ;
+            const double rt = t*tan_phi;
+            Values[i] = rx*rx + ry*ry + rz*rz - rt*rt;
+            if(mIsTruncated)
+                Values[i] = std::max(Values[i], (t - mtMin)*(t - mtMax));
+        }
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        typedef FunctionTape<InputType, OutputType> TapeType;
+        std::size_t dx = rTape.AddBinary(TapeType::SUBTRACT, rTape.AddVariable(0), rTape.AddConstant(mcX));
+        std::size_t dy = rTape.AddBinary(TapeType::SUBTRACT, rTape.AddVariable(1), rTape.AddConstant(mcY));
+        std::size_t dz = rTape.AddBinary(TapeType::SUBTRACT, rTape.AddVariable(2), rTape.AddConstant(mcZ));
+        std::size_t t = rTape.AddBinary(TapeType::ADD, rTape.AddUnary(TapeType::SCALE, dx, mdX), rTape.AddUnary(TapeType::SCALE, dy, mdY));
+        t = rTape.AddBinary(TapeType::ADD, t, rTape.AddUnary(TapeType::SCALE, dz, mdZ));
+        std::size_t rx = rTape.AddBinary(TapeType::SUBTRACT, dx, rTape.AddUnary(TapeType::SCALE, t, mdX));
+        std::size_t ry = rTape.AddBinary(TapeType::SUBTRACT, dy, rTape.AddUnary(TapeType::SCALE, t, mdY));
+        std::size_t rz = rTape.AddBinary(TapeType::SUBTRACT, dz, rTape.AddUnary(TapeType::SCALE, t, mdZ));
+        std::size_t r2 = rTape.AddBinary(TapeType::ADD, rTape.AddUnary(TapeType::SQUARE, rx), rTape.AddUnary(TapeType::SQUARE, ry));
+        r2 = rTape.AddBinary(TapeType::ADD, r2, rTape.AddUnary(TapeType::SQUARE, rz));
+        std::size_t rt = rTape.AddUnary(TapeType::SCALE, t, std::tan(mphi*PI/180));
+        std::size_t value = rTape.AddBinary(TapeType::SUBTRACT, r2, rTape.AddUnary(TapeType::SQUARE, rt));
+        if(!mIsTruncated)
+            return value;
+        std::size_t cap = rTape.AddBinary(TapeType::MULTIPLY, rTape.AddBinary(TapeType::SUBTRACT, t, rTape.AddConstant(mtMin)),
+                rTape.AddBinary(TapeType::SUBTRACT, t, rTape.AddConstant(mtMax)));
+        return rTape.AddBinary(TapeType::MAX, value, cap);
     }
 
 
@@ -145,6 +247,68 @@ public:
     // }
 
 
+    virtual void GetGradient(const PointType& P, array_1d<double, 3>& rGradient) const
+    {
+        double value;
+        bounded_matrix<double, 3, 3> hess;
+        this->GetValueGradientHessian(P, value, rGradient, hess);
+    }
+
+
+    virtual void GetGradientDerivatives(const PointType& P, bounded_matrix<double, 3, 3>& rDerivatives) const
+    {
+        double value;
+        array_1d<double, 3> grad;
+        this->GetValueGradientHessian(P, value, grad, rDerivatives);
+    }
+
+
+    virtual void GetValueGradientHessian(const PointType& P, double& rValue, array_1d<double, 3>& rGradient,
+            bounded_matrix<double, 3, 3>& rHessian) const
+    {
+        const double d[] = {mdX, mdY, mdZ};
+        const double tan_phi = std::tan(mphi*PI/180);
+        const double dx = P(0) - mcX;
+        const double dy = P(1) - mcY;
+        const double dz = P(2) - mcZ;
+
+        // the axial projection is computed once for the value, the gradient and the Hessian
+        const double t = dx*mdX + dy*mdY + dz*mdZ;
+        const double rx = dx - t*mdX;
+        const double ry = dy - t*mdY;
+        const double rz = dz - t*mdZ;
+        const double k2 = tan_phi*tan_phi;
+
+        rValue = rx*rx + ry*ry + rz*rz - k2*t*t;
+
+        // beyond the caps of the truncated cone, the level set is the quadratic of the axial coordinate
+        if(mIsTruncated)
+        {
+            const double cap = (t - mtMin)*(t - mtMax);
+            if(cap > rValue)
+            {
+                rValue = cap;
+                const double dcap = 2.0*t - mtMin - mtMax;
+                for (std::size_t i = 0; i < 3; ++i)
+                {
+                    rGradient[i] = dcap*d[i];
+                    for (std::size_t j = 0; j < 3; ++j)
+                        rHessian(i, j) = 2.0*d[i]*d[j];
+                }
+                return;
+            }
+        }
+
+        rGradient[0] = 2.0 * (rx - k2*t*mdX);
+        rGradient[1] = 2.0 * (ry - k2*t*mdY);
+        rGradient[2] = 2.0 * (rz - k2*t*mdZ);
+
+        for (std::size_t i = 0; i < 3; ++i)
+            for (std::size_t j = 0; j < 3; ++j)
+                rHessian(i, j) = 2.0 * ((i == j ? 1.0 : 0.0) - (1.0 + k2)*d[i]*d[j]);
+    }
+
+
     // /// Generate the sampling points on the level set surface
     // std::vector<std::vector<PointType> > GeneratePoints(const std::size_t& nsampling_axial, const std::size_t& nsampling_radial,
     //     const double& start_angle, const double& end_angle) const
@@ -205,6 +369,8 @@ public:
         rOStream << "cX: " << mcX << ", cY: " << mcY << ", cZ: " << mcZ
                  << "dX: " << mdX << ", dY: " << mdY << ", dZ: " << mdZ
                  << ", phi: " << mphi;
+        if(mIsTruncated)
+            rOStream << ", tmin: " << mtMin << ", tmax: " << mtMax;
     }
 
 
@@ -266,6 +432,8 @@ private:
     double mdX, mdY, mdZ; // director vector
     double mLength;
     double mphi;
+    bool mIsTruncated;
+    double mtMin, mtMax; // axial range of the truncated cone
 
 
     ///@}
@@ -277,6 +445,39 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("cX", mcX);
+        rSerializer.save("cY", mcY);
+        rSerializer.save("cZ", mcZ);
+        rSerializer.save("dX", mdX);
+        rSerializer.save("dY", mdY);
+        rSerializer.save("dZ", mdZ);
+        rSerializer.save("Length", mLength);
+        rSerializer.save("phi", mphi);
+        rSerializer.save("IsTruncated", mIsTruncated);
+        rSerializer.save("tMin", mtMin);
+        rSerializer.save("tMax", mtMax);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("cX", mcX);
+        rSerializer.load("cY", mcY);
+        rSerializer.load("cZ", mcZ);
+        rSerializer.load("dX", mdX);
+        rSerializer.load("dY", mdY);
+        rSerializer.load("dZ", mdZ);
+        rSerializer.load("Length", mLength);
+        rSerializer.load("phi", mphi);
+        rSerializer.load("IsTruncated", mIsTruncated);
+        rSerializer.load("tMin", mtMin);
+        rSerializer.load("tMax", mtMax);
+    }
 
     ///@}
     ///@name Private  Access
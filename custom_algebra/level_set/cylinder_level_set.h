@@ -90,6 +90,10 @@ public:
         mdZ = dZ / mLength;
     }
 
+    /// Default constructor, only used by the serializer.
+    CylinderLevelSet() : BaseType(), mcX(0.0), mcY(0.0), mcZ(0.0), mdX(0.0), mdY(0.0), mdZ(0.0), mLength(0.0), mR(0.0)
+    {}
+
     /// Copy constructor.
     CylinderLevelSet(CylinderLevelSet const& rOther)
     : BaseType(rOther), mcX(rOther.mcX), mcY(rOther.mcY), mcZ(rOther.mcZ)
@@ -122,6 +126,29 @@ public:
     }
 
 
+    /// The cylinder is infinite, hence it is only bounded in the directions normal to its axis
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        const double c[] = {mcX, mcY, mcZ};
+        const double n[] = {mdX, mdY, mdZ};
+        const double R = std::fabs(mR);
+        for(int d = 0; d < 3; ++d)
+        {
+            if(n[d] == 0.0)
+            {
+                rMin[d] = c[d] - R;
+                rMax[d] = c[d] + R;
+            }
+            else
+            {
+                rMin[d] = -std::numeric_limits<double>::infinity();
+                rMax[d] = std::numeric_limits<double>::infinity();
+            }
+        }
+        return true;
+    }
+
+
     virtual double GetValue(const PointType& P) const
     {
         double t = (P(0) - mcX) * mdX + (P(1) - mcY) * mdY + (P(2) - mcZ) * mdZ;
@@ -135,7 +162,41 @@ public:
     }
 
 
-    virtual Vector GetGradient(const PointType& P) const
+    virtual void GetValues(const PointType* P, const std::size_t n, double* Values) const
+    {
+        const double R2 = mR*mR;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            const double dx = P[i][0] - mcX;
+            const double dy = P[i][1] - mcY;
+            const double dz = P[i][2] - mcZ;
+            const double t = dx*mdX + dy*mdY + dz*mdZ;
+            const double rx = dx - t*mdX;
+            const double ry = dy - t*mdY;
+            const double rz = dz - t*mdZ;
+            Values[i] = rx*rx + ry*ry + rz*rz - R2;
+        }
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        typedef FunctionTape<InputType, OutputType> TapeType;
+        std::size_t dx = rTape.AddBinary(TapeType::SUBTRACT, rTape.AddVariable(0), rTape.AddConstant(mcX));
+        std::size_t dy = rTape.AddBinary(TapeType::SUBTRACT, rTape.AddVariable(1), rTape.AddConstant(mcY));
+        std::size_t dz = rTape.AddBinary(TapeType::SUBTRACT, rTape.AddVariable(2), rTape.AddConstant(mcZ));
+        std::size_t t = rTape.AddBinary(TapeType::ADD, rTape.AddUnary(TapeType::SCALE, dx, mdX), rTape.AddUnary(TapeType::SCALE, dy, mdY));
+        t = rTape.AddBinary(TapeType::ADD, t, rTape.AddUnary(TapeType::SCALE, dz, mdZ));
+        std::size_t rx = rTape.AddBinary(TapeType::SUBTRACT, dx, rTape.AddUnary(TapeType::SCALE, t, mdX));
+        std::size_t ry = rTape.AddBinary(TapeType::SUBTRACT, dy, rTape.AddUnary(TapeType::SCALE, t, mdY));
+        std::size_t rz = rTape.AddBinary(TapeType::SUBTRACT, dz, rTape.AddUnary(TapeType::SCALE, t, mdZ));
+        std::size_t r2 = rTape.AddBinary(TapeType::ADD, rTape.AddUnary(TapeType::SQUARE, rx), rTape.AddUnary(TapeType::SQUARE, ry));
+        r2 = rTape.AddBinary(TapeType::ADD, r2, rTape.AddUnary(TapeType::SQUARE, rz));
+        return rTape.AddBinary(TapeType::SUBTRACT, r2, rTape.AddConstant(mR*mR));
+    }
+
+
+    virtual void GetGradient(const PointType& P, array_1d<double, 3>& rGradient) const
     {
 //        double pX = (P(0) - mcX) * mdX;
 //        double pY = (P(1) - mcY) * mdY;
@@ -149,31 +210,51 @@ public:
         double pX = mcX + t*mdX;
         double pY = mcY + t*mdY;
         double pZ = mcZ + t*mdZ;
-        Vector grad(3);
-        grad(0) = 2.0 * (P(0) - pX) * (1.0 - mdX*mdX);
-        grad(1) = 2.0 * (P(1) - pY) * (1.0 - mdY*mdY);
-        grad(2) = 2.0 * (P(2) - pZ) * (1.0 - mdZ*mdZ);
-        return grad;
+        rGradient[0] = 2.0 * (P(0) - pX);
+        rGradient[1] = 2.0 * (P(1) - pY);
+        rGradient[2] = 2.0 * (P(2) - pZ);
     }
 
 
-    virtual Matrix GetGradientDerivatives(const PointType& P) const
+    virtual void GetGradientDerivatives(const PointType& P, bounded_matrix<double, 3, 3>& rDerivatives) const
     {
-        Matrix Jac(3, 3);
+        rDerivatives(0, 0) = 2.0 * (1.0 - mdX*mdX);
+        rDerivatives(0, 1) = 2.0 * (-mdX*mdY);
+        rDerivatives(0, 2) = 2.0 * (-mdX*mdZ);
 
-        Jac(0, 0) = 2.0 * (1.0 - mdX*mdX) * (1.0 - mdX*mdX);
-        Jac(0, 1) = 2.0 * (1.0 - mdX*mdX) * (-mdX*mdY);
-        Jac(0, 2) = 2.0 * (1.0 - mdX*mdX) * (-mdX*mdZ);
+        rDerivatives(1, 0) = 2.0 * (-mdY*mdX);
+        rDerivatives(1, 1) = 2.0 * (1.0 - mdY*mdY);
+        rDerivatives(1, 2) = 2.0 * (-mdY*mdZ);
 
-        Jac(1, 0) = 2.0 * (1.0 - mdY*mdY) * (-mdY*mdX);
-        Jac(1, 1) = 2.0 * (1.0 - mdY*mdY) * (1.0 - mdY*mdY);
-        Jac(1, 2) = 2.0 * (1.0 - mdY*mdY) * (-mdY*mdZ);
+        rDerivatives(2, 0) = 2.0 * (-mdZ*mdX);
+        rDerivatives(2, 1) = 2.0 * (-mdZ*mdY);
+        rDerivatives(2, 2) = 2.0 * (1.0 - mdZ*mdZ);
+    }
 
-        Jac(2, 0) = 2.0 * (1.0 - mdZ*mdZ) * (-mdZ*mdX);
-        Jac(2, 1) = 2.0 * (1.0 - mdZ*mdZ) * (-mdZ*mdY);
-        Jac(2, 2) = 2.0 * (1.0 - mdZ*mdZ) * (1.0 - mdZ*mdZ);
 
-        return Jac;
+    virtual void GetValueGradientHessian(const PointType& P, double& rValue, array_1d<double, 3>& rGradient,
+            bounded_matrix<double, 3, 3>& rHessian) const
+    {
+        const double d[] = {mdX, mdY, mdZ};
+        const double dx = P(0) - mcX;
+        const double dy = P(1) - mcY;
+        const double dz = P(2) - mcZ;
+
+        // the axial projection is computed once for the value, the gradient and the Hessian
+        const double t = dx*mdX + dy*mdY + dz*mdZ;
+        const double rx = dx - t*mdX;
+        const double ry = dy - t*mdY;
+        const double rz = dz - t*mdZ;
+
+        rValue = rx*rx + ry*ry + rz*rz - mR*mR;
+
+        rGradient[0] = 2.0 * rx;
+        rGradient[1] = 2.0 * ry;
+        rGradient[2] = 2.0 * rz;
+
+        for (std::size_t i = 0; i < 3; ++i)
+            for (std::size_t j = 0; j < 3; ++j)
+                rHessian(i, j) = 2.0 * ((i == j ? 1.0 : 0.0) - d[i]*d[j]);
     }
 
 
@@ -405,6 +486,26 @@ protected:
     ///@{
 
 
+    /// The norm of the gradient is twice the distance to the axis, which is convex, hence it is bounded by its value
+    /// at the corners of the box
+    virtual double ComputeLipschitzConstant(const PointType& rMin, const PointType& rMax) const
+    {
+        double r2 = 0.0;
+        for(int corner = 0; corner < 8; ++corner)
+        {
+            const double x = (corner & 1) ? rMax[0] : rMin[0];
+            const double y = (corner & 2) ? rMax[1] : rMin[1];
+            const double z = (corner & 4) ? rMax[2] : rMin[2];
+            const double t = (x - mcX) * mdX + (y - mcY) * mdY + (z - mcZ) * mdZ;
+            const double rx = x - mcX - t*mdX;
+            const double ry = y - mcY - t*mdY;
+            const double rz = z - mcZ - t*mdZ;
+            r2 = std::max(r2, rx*rx + ry*ry + rz*rz);
+        }
+        return 2.0*std::sqrt(r2);
+    }
+
+
     ///@}
     ///@name Protected  Access
     ///@{
@@ -447,6 +548,33 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("cX", mcX);
+        rSerializer.save("cY", mcY);
+        rSerializer.save("cZ", mcZ);
+        rSerializer.save("dX", mdX);
+        rSerializer.save("dY", mdY);
+        rSerializer.save("dZ", mdZ);
+        rSerializer.save("Length", mLength);
+        rSerializer.save("R", mR);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("cX", mcX);
+        rSerializer.load("cY", mcY);
+        rSerializer.load("cZ", mcZ);
+        rSerializer.load("dX", mdX);
+        rSerializer.load("dY", mdY);
+        rSerializer.load("dZ", mdZ);
+        rSerializer.load("Length", mLength);
+        rSerializer.load("R", mR);
+    }
 
     ///@}
     ///@name Private  Access
@@ -88,6 +88,10 @@ public:
     : BaseType(), mp_level_set_1(p_level_set_1), mp_level_set_2(p_level_set_2)
     {}
 
+    /// Default constructor, only used by the serializer.
+    DifferenceLevelSet() : BaseType()
+    {}
+
     /// Copy constructor.
     DifferenceLevelSet(DifferenceLevelSet const& rOther)
     : BaseType(rOther)
@@ -121,18 +125,82 @@ public:
     }
 
 
+    /// The difference is bounded by the first level set
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        return mp_level_set_1->GetBoundingBox(rMin, rMax);
+    }
+
+
+    virtual int CutStatusOfBox(const PointType& rMin, const PointType& rMax) const
+    {
+        const int stat_1 = mp_level_set_1->CutStatusOfBox(rMin, rMax);
+        if(stat_1 == BRep::_OUT)
+            return BRep::_OUT;
+
+        const int stat_2 = mp_level_set_2->CutStatusOfBox(rMin, rMax);
+        if(stat_2 == BRep::_IN)
+            return BRep::_OUT;
+
+        if(stat_1 == BRep::_IN && stat_2 == BRep::_OUT)
+            return BRep::_IN;
+
+        return BRep::_CUT;
+    }
+
+
     virtual double GetValue(const PointType& P) const
     {
         return std::max(mp_level_set_1->GetValue(P), -mp_level_set_2->GetValue(P));
     }
 
 
-    virtual Vector GetGradient(const PointType& P) const
+    virtual void GetValues(const PointType* P, const std::size_t n, double* Values) const
+    {
+        std::vector<double> Values2(n);
+        mp_level_set_1->GetValues(P, n, Values);
+        mp_level_set_2->GetValues(P, n, &Values2[0]);
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = std::max(Values[i], -Values2[i]);
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        typedef FunctionTape<InputType, OutputType> TapeType;
+        std::size_t phi_2 = rTape.AddUnary(TapeType::NEGATE, mp_level_set_2->Compile(rTape));
+        return rTape.AddBinary(TapeType::MAX, mp_level_set_1->Compile(rTape), phi_2);
+    }
+
+
+    virtual void GetGradient(const PointType& P, array_1d<double, 3>& rGradient) const
     {
         if (mp_level_set_1->GetValue(P) > -mp_level_set_2->GetValue(P))
-            return mp_level_set_1->GetGradient(P);
+            mp_level_set_1->GetGradient(P, rGradient);
         else
-            return -mp_level_set_2->GetGradient(P);
+        {
+            mp_level_set_2->GetGradient(P, rGradient);
+            rGradient *= -1.0;
+        }
+    }
+
+
+    /// The derivatives are the ones of the level set giving the maximum, as in GetGradient
+    virtual void GetValueGradientHessian(const PointType& P, double& rValue, array_1d<double, 3>& rGradient,
+            bounded_matrix<double, 3, 3>& rHessian) const
+    {
+        double phi_2;
+        array_1d<double, 3> grad_2;
+        bounded_matrix<double, 3, 3> hess_2;
+        mp_level_set_1->GetValueGradientHessian(P, rValue, rGradient, rHessian);
+        mp_level_set_2->GetValueGradientHessian(P, phi_2, grad_2, hess_2);
+
+        if (rValue <= -phi_2)
+        {
+            rValue = -phi_2;
+            noalias(rGradient) = -grad_2;
+            noalias(rHessian) = -hess_2;
+        }
     }
 
 
@@ -185,8 +253,8 @@ protected:
     ///@{
 
 
-    const BaseType::Pointer mp_level_set_1;
-    const BaseType::Pointer mp_level_set_2;
+    BaseType::Pointer mp_level_set_1;
+    BaseType::Pointer mp_level_set_2;
 
 
     ///@}
@@ -199,6 +267,13 @@ protected:
     ///@{
 
 
+    /// The Lipschitz constant of the maximum of two functions is bounded by the larger one
+    virtual double ComputeLipschitzConstant(const PointType& rMin, const PointType& rMax) const
+    {
+        return std::max(mp_level_set_1->GetLipschitzConstant(rMin, rMax), mp_level_set_2->GetLipschitzConstant(rMin, rMax));
+    }
+
+
     ///@}
     ///@name Protected  Access
     ///@{
@@ -235,6 +310,21 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("LevelSet1", mp_level_set_1);
+        rSerializer.save("LevelSet2", mp_level_set_2);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("LevelSet1", mp_level_set_1);
+        rSerializer.load("LevelSet2", mp_level_set_2);
+    }
 
     ///@}
     ///@name Private  Access
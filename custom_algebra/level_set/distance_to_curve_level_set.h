@@ -19,6 +19,9 @@
 
 // System includes
 #include <string>
+#include <vector>
+#include <limits>
+#include <algorithm>
 #include <iostream>
 
 
@@ -80,6 +83,10 @@ public:
     : BaseType(), mpCurve(pAlignCurve), mR(R)
     {}
 
+    /// Default constructor, only used by the serializer.
+    DistanceToCurveLevelSet() : BaseType(), mR(0.0)
+    {}
+
     /// Copy constructor.
     DistanceToCurveLevelSet(DistanceToCurveLevelSet const& rOther)
     : BaseType(rOther), mpCurve(rOther.mpCurve->Clone()), mR(rOther.mR)
@@ -111,15 +118,111 @@ public:
     }
 
 
+    /// The projection is always a point of the curve within its search bounds, hence the domain lies within the distance
+    /// R of the curve. The curve is sampled at the segments of its search, each segment lies within the box of its chord
+    /// inflated by the sagitta h^2/8 max|Q''|, where |Q''| is taken at the ends of the segment.
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        const Curve::SearchSettings& Settings = mpCurve->GetSearchSettings();
+        const std::size_t nsegments = static_cast<std::size_t>(std::max(Settings.NumberOfSampling, 1));
+        const double h = (Settings.UpperBound - Settings.LowerBound) / nsegments;
+
+        std::vector<double> Stations(nsegments + 1);
+        for (std::size_t i = 0; i < nsegments + 1; ++i)
+            Stations[i] = Settings.LowerBound + i*h;
+
+        std::vector<array_1d<double, 3> > CurvePoints(nsegments + 1), CurveSecondDerivatives(nsegments + 1);
+        mpCurve->GetValuesAndDerivatives(&Stations[0], nsegments + 1, &CurvePoints[0], NULL, &CurveSecondDerivatives[0]);
+
+        for (std::size_t d = 0; d < 3; ++d)
+        {
+            rMin[d] = std::numeric_limits<double>::infinity();
+            rMax[d] = -std::numeric_limits<double>::infinity();
+        }
+
+        const double R = std::fabs(mR);
+        double dd_prev = norm_2(CurveSecondDerivatives[0]);
+        for (std::size_t i = 0; i < nsegments; ++i)
+        {
+            const double dd_next = norm_2(CurveSecondDerivatives[i+1]);
+            const double sagitta = 0.125*h*h*std::max(dd_prev, dd_next);
+            dd_prev = dd_next;
+
+            for (std::size_t d = 0; d < 3; ++d)
+            {
+                rMin[d] = std::min(rMin[d], std::min(CurvePoints[i][d], CurvePoints[i+1][d]) - sagitta - R);
+                rMax[d] = std::max(rMax[d], std::max(CurvePoints[i][d], CurvePoints[i+1][d]) + sagitta + R);
+            }
+        }
+
+        return true;
+    }
+
+
     virtual double GetValue(const PointType& P) const
     {
         return mpCurve->ComputeDistance(P) - mR;
     }
 
 
-    virtual Vector GetGradient(const PointType& P) const
+    /// The gradient is the unit vector from the projection on the curve to the point
+    virtual void GetGradient(const PointType& P, array_1d<double, 3>& rGradient) const
+    {
+        PointType Proj;
+        mpCurve->ProjectOnCurve(P, Proj);
+
+        noalias(rGradient) = P - Proj;
+        const double d = norm_2(rGradient);
+        if (d == 0.0)
+            noalias(rGradient) = ZeroVector(3);
+        else
+            rGradient /= d;
+    }
+
+
+    virtual void GetGradientDerivatives(const PointType& P, bounded_matrix<double, 3, 3>& rDerivatives) const
     {
-        KRATOS_THROW_ERROR(std::logic_error, __FUNCTION__, "Not yet implemented")
+        double value;
+        array_1d<double, 3> grad;
+        this->GetValueGradientHessian(P, value, grad, rDerivatives);
+    }
+
+
+    /// The gradient is the unit vector n from the projection Q(t) on the curve to the point. The Hessian is
+    /// [(I - n n^T) - Q' (dt/dP)^T] / d, with dt/dP = Q' / (|Q'|^2 - (P - Q).Q'') from the orthogonality of the projection.
+    /// If the projection is clamped at an end of the curve, t does not depend on the point.
+    virtual void GetValueGradientHessian(const PointType& P, double& rValue, array_1d<double, 3>& rGradient,
+            bounded_matrix<double, 3, 3>& rHessian) const
+    {
+        PointType Proj;
+        double t;
+        mpCurve->ProjectOnCurve(P, Proj, t);
+
+        const array_1d<double, 3> V = P - Proj;
+        const double d = norm_2(V);
+
+        rValue = d - mR;
+
+        noalias(rGradient) = ZeroVector(3);
+        noalias(rHessian) = ZeroMatrix(3, 3);
+        if (d == 0.0)
+            return;
+
+        noalias(rGradient) = V / d;
+
+        const Curve::SearchSettings& Settings = mpCurve->GetSearchSettings();
+        array_1d<double, 3> dtdP = ZeroVector(3);
+        array_1d<double, 3> dQ = ZeroVector(3);
+        if ((t > Settings.LowerBound) && (t < Settings.UpperBound))
+        {
+            noalias(dQ) = mpCurve->GetDerivative(0, t);
+            const array_1d<double, 3> ddQ = mpCurve->GetSecondDerivative(0, 0, t);
+            noalias(dtdP) = dQ / (inner_prod(dQ, dQ) - inner_prod(V, ddQ));
+        }
+
+        for (std::size_t i = 0; i < 3; ++i)
+            for (std::size_t j = 0; j < 3; ++j)
+                rHessian(i, j) = ((i == j ? 1.0 : 0.0) - rGradient[i]*rGradient[j] - dQ[i]*dtdP[j]) / d;
     }
 
 
@@ -147,19 +250,27 @@ public:
 
         double small_angle = (end_angle - start_angle) / nsampling_radial;
 
-        double t, d;
+        // evaluate the curve and its tangent at all the stations in one sweep
+        std::vector<double> Stations(nsampling_axial);
+        for (std::size_t i = 0; i < nsampling_axial; ++i)
+            Stations[i] = tmin + i*(tmax-tmin)/(nsampling_axial-1);
+
+        std::vector<array_1d<double, 3> > CurvePoints(nsampling_axial), CurveTangents(nsampling_axial);
+        if (nsampling_axial != 0)
+            mpCurve->GetValuesAndDerivatives(&Stations[0], nsampling_axial, &CurvePoints[0], &CurveTangents[0], NULL);
+
+        double d;
         PointType P, T, N, B, V, Up, Aux;
         Up[0] = 0.0; Up[1] = 0.0; Up[2] = 1.0;
         results.resize(nsampling_axial);
         for (std::size_t i = 0; i < nsampling_axial; ++i)
         {
-            t = tmin + i*(tmax-tmin)/(nsampling_axial-1);
-            // KRATOS_WATCH(t)
+            // KRATOS_WATCH(Stations[i])
 
-            noalias(P) = mpCurve->GetValue(t);
+            noalias(P) = CurvePoints[i];
             // KRATOS_WATCH(P)
 
-            noalias(T) = mpCurve->GetDerivative(0, t);
+            noalias(T) = CurveTangents[i];
             T *= 1.0/norm_2(T);
             // KRATOS_WATCH(T)
 
@@ -355,6 +466,14 @@ protected:
     ///@{
 
 
+    /// The level set is a distance, assuming that the projection on the curve is unique, i.e. the points stay within
+    /// the radius of curvature of the curve
+    virtual double ComputeLipschitzConstant(const PointType& rMin, const PointType& rMax) const
+    {
+        return 1.0;
+    }
+
+
     ///@}
     ///@name Protected  Access
     ///@{
@@ -382,7 +501,7 @@ private:
     ///@{
 
 
-    const Curve::Pointer mpCurve;
+    Curve::Pointer mpCurve;
     double mR;
 
 
@@ -395,6 +514,21 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("Curve", mpCurve);
+        rSerializer.save("R", mR);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("Curve", mpCurve);
+        rSerializer.load("R", mR);
+    }
 
     ///@}
     ///@name Private  Access
@@ -79,6 +79,10 @@ public:
     {
     }
 
+    /// Default constructor, only used by the serializer.
+    DoughnutLevelSet() : BaseType(), mR(0.0), mr(0.0)
+    {}
+
     /// Copy constructor.
     DoughnutLevelSet(DoughnutLevelSet const& rOther)
     : BaseType(rOther), mR(rOther.mR), mr(rOther.mr)
@@ -110,20 +114,75 @@ public:
     }
 
 
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        const double R = std::fabs(mR) + std::fabs(mr);
+        rMin[0] = -R; rMax[0] = R;
+        rMin[1] = -R; rMax[1] = R;
+        rMin[2] = -std::fabs(mr); rMax[2] = std::fabs(mr);
+        return true;
+    }
+
+
     virtual double GetValue(const PointType& P) const
     {
         return pow(mR - sqrt(pow(P(0), 2) + pow(P(1), 2)), 2) + pow(P(2), 2) - pow(mr, 2);
     }
 
 
-    virtual Vector GetGradient(const PointType& P) const
+    virtual void GetValues(const PointType* P, const std::size_t n, double* Values) const
+    {
+        const double r2 = mr*mr;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            const double d = mR - sqrt(P[i][0]*P[i][0] + P[i][1]*P[i][1]);
+            Values[i] = d*d + P[i][2]*P[i][2] - r2;
+        }
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        typedef FunctionTape<InputType, OutputType> TapeType;
+        std::size_t x2 = rTape.AddUnary(TapeType::SQUARE, rTape.AddVariable(0));
+        std::size_t y2 = rTape.AddUnary(TapeType::SQUARE, rTape.AddVariable(1));
+        std::size_t rho = rTape.AddUnary(TapeType::SQRT, rTape.AddBinary(TapeType::ADD, x2, y2));
+        std::size_t d = rTape.AddBinary(TapeType::SUBTRACT, rTape.AddConstant(mR), rho);
+        std::size_t v = rTape.AddBinary(TapeType::ADD, rTape.AddUnary(TapeType::SQUARE, d), rTape.AddUnary(TapeType::SQUARE, rTape.AddVariable(2)));
+        return rTape.AddBinary(TapeType::SUBTRACT, v, rTape.AddConstant(mr*mr));
+    }
+
+
+    virtual void GetGradient(const PointType& P, array_1d<double, 3>& rGradient) const
     {
-        Vector grad(3);
-        double aux = pow(mR - sqrt(pow(P(0), 2) + pow(P(1), 2)), 2);
-        grad(0) = 2.0 * aux * ( -P(0) / sqrt(pow(P(0), 2) + pow(P(1), 2)) );
-        grad(1) = 2.0 * aux * ( -P(1) / sqrt(pow(P(0), 2) + pow(P(1), 2)) );
-        grad(2) = 2.0 * P(2);
-        return grad;
+        double aux = mR - sqrt(pow(P(0), 2) + pow(P(1), 2));
+        rGradient[0] = 2.0 * aux * ( -P(0) / sqrt(pow(P(0), 2) + pow(P(1), 2)) );
+        rGradient[1] = 2.0 * aux * ( -P(1) / sqrt(pow(P(0), 2) + pow(P(1), 2)) );
+        rGradient[2] = 2.0 * P(2);
+    }
+
+
+    virtual void GetValueGradientHessian(const PointType& P, double& rValue, array_1d<double, 3>& rGradient,
+            bounded_matrix<double, 3, 3>& rHessian) const
+    {
+        const double rho = sqrt(P(0)*P(0) + P(1)*P(1));
+        const double d = mR - rho;
+        const double nx = P(0) / rho;
+        const double ny = P(1) / rho;
+
+        rValue = d*d + P(2)*P(2) - mr*mr;
+
+        rGradient[0] = -2.0 * d * nx;
+        rGradient[1] = -2.0 * d * ny;
+        rGradient[2] = 2.0 * P(2);
+
+        // the derivatives of the radial direction (nx, ny) are (I - n n^T) / rho
+        noalias(rHessian) = ZeroMatrix(3, 3);
+        rHessian(0, 0) = 2.0 * nx * nx - 2.0 * d * ny * ny / rho;
+        rHessian(0, 1) = 2.0 * nx * ny + 2.0 * d * nx * ny / rho;
+        rHessian(1, 0) = rHessian(0, 1);
+        rHessian(1, 1) = 2.0 * ny * ny - 2.0 * d * nx * nx / rho;
+        rHessian(2, 2) = 2.0;
     }
 
 
@@ -184,6 +243,19 @@ protected:
     ///@{
 
 
+    /// The norm of the gradient is twice the distance to the center circle, which is bounded by |P| + R
+    virtual double ComputeLipschitzConstant(const PointType& rMin, const PointType& rMax) const
+    {
+        double d2 = 0.0;
+        for(int d = 0; d < 3; ++d)
+        {
+            const double a = std::max(std::fabs(rMin[d]), std::fabs(rMax[d]));
+            d2 += a*a;
+        }
+        return 2.0*(std::sqrt(d2) + std::fabs(mR));
+    }
+
+
     ///@}
     ///@name Protected  Access
     ///@{
@@ -223,6 +295,21 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("R", mR);
+        rSerializer.save("r", mr);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("R", mR);
+        rSerializer.load("r", mr);
+    }
 
     ///@}
     ///@name Private  Access
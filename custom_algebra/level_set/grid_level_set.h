@@ -0,0 +1,707 @@
+//    |  /           |
+//    ' /   __| _` | __|  _ \   __|
+//    . \  |   (   | |   (   |\__ `
+//   _|\_\_|  \__,_|\__|\___/ ____/
+//                   Multi-Physics
+//
+//  License:         brep_application/LICENSE.txt
+//                   Kratos default license: kratos/license.txt
+//
+//  Main authors:    Hoang-Giang Bui
+//  Date:            16 Oct 2026
+//
+
+
+#if !defined(KRATOS_GRID_LEVEL_SET_H_INCLUDED )
+#define  KRATOS_GRID_LEVEL_SET_H_INCLUDED
+
+
+
+// System includes
+#include <string>
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <iostream>
+
+
+// External includes
+
+
+// Project includes
+#include "includes/define.h"
+#include "custom_algebra/level_set/level_set.h"
+
+
+namespace Kratos
+{
+///@addtogroup BRepApplication
+///@{
+
+///@name Kratos Globals
+///@{
+
+///@}
+///@name Type Definitions
+///@{
+
+///@}
+///@name  Enum's
+///@{
+
+///@}
+///@name  Functions
+///@{
+
+///@}
+///@name Kratos Classes
+///@{
+
+/// Short class definition.
+/** Level set sampled on a regular grid, e.g. to bake a deep composite level set once and query it many times.
+ * The grid is split into bricks of BRICK_SIZE^3 nodes. Only the bricks containing a node within the narrow band
+ * |phi| <= bandwidth, or cut by the level set, are allocated. The other bricks only keep their sign, and their nodes
+ * take the value -bandwidth (inside) or +bandwidth (outside).
+ * The values are interpolated by trilinear (order 1) or tricubic Catmull-Rom (order 3) interpolation. The points
+ * outside of the grid are clamped to the grid, hence the domain is bounded by the grid on the sides where the
+ * boundary face of the grid is outside.
+ */
+class GridLevelSet : public LevelSet
+{
+public:
+    ///@name Type Definitions
+    ///@{
+
+    /// Pointer definition of GridLevelSet
+    KRATOS_CLASS_POINTER_DEFINITION(GridLevelSet);
+
+    typedef LevelSet BaseType;
+
+    /// Number of nodes of a brick in each direction
+    static const std::size_t BRICK_SIZE = 8;
+
+    /// Brick index of the unallocated bricks
+    static const int BRICK_INSIDE = -2;
+    static const int BRICK_OUTSIDE = -1;
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// Default constructor.
+    /// The level set is sampled at the nodes of the grid spanning [MinPoint, MaxPoint] with the given spacing.
+    GridLevelSet(const LevelSet::Pointer pLevelSet, const array_1d<double, 3>& MinPoint, const array_1d<double, 3>& MaxPoint,
+        const double& Spacing, const double& BandWidth, const int& Order)
+    : BaseType(), mMinPoint(MinPoint), mSpacing(Spacing), mBandWidth(BandWidth), mOrder(Order)
+    {
+        if(mSpacing <= 0.0)
+            KRATOS_THROW_ERROR(std::logic_error, "The grid spacing must be positive", "")
+
+        if(mBandWidth <= 0.0)
+            KRATOS_THROW_ERROR(std::logic_error, "The band width must be positive", "")
+
+        if(mOrder != 1 && mOrder != 3)
+            KRATOS_THROW_ERROR(std::logic_error, "The interpolation order must be 1 or 3, order =", mOrder)
+
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            if(MaxPoint[d] <= MinPoint[d])
+                KRATOS_THROW_ERROR(std::logic_error, "The grid is empty in the direction", d)
+
+            mNumberOfNodes[d] = static_cast<std::size_t>(std::ceil((MaxPoint[d] - MinPoint[d]) / mSpacing)) + 1;
+            mNumberOfBricks[d] = (mNumberOfNodes[d] + BRICK_SIZE - 1) / BRICK_SIZE;
+        }
+
+        this->Bake(*pLevelSet);
+    }
+
+    /// Default constructor, only used by the serializer.
+    GridLevelSet() : BaseType(), mSpacing(1.0), mBandWidth(1.0), mOrder(1)
+    {
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            mMinPoint[d] = 0.0;
+            mNumberOfNodes[d] = 0;
+            mNumberOfBricks[d] = 0;
+            mIsFaceOutside[d][0] = false;
+            mIsFaceOutside[d][1] = false;
+        }
+    }
+
+    /// Copy constructor.
+    GridLevelSet(GridLevelSet const& rOther)
+    : BaseType(rOther), mMinPoint(rOther.mMinPoint), mSpacing(rOther.mSpacing)
+    , mBandWidth(rOther.mBandWidth), mOrder(rOther.mOrder)
+    , mBrickIndex(rOther.mBrickIndex), mBrickValues(rOther.mBrickValues)
+    {
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            mNumberOfNodes[d] = rOther.mNumberOfNodes[d];
+            mNumberOfBricks[d] = rOther.mNumberOfBricks[d];
+            mIsFaceOutside[d][0] = rOther.mIsFaceOutside[d][0];
+            mIsFaceOutside[d][1] = rOther.mIsFaceOutside[d][1];
+        }
+    }
+
+    /// Destructor.
+    virtual ~GridLevelSet() {}
+
+
+    ///@}
+    ///@name Operators
+    ///@{
+
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+
+    virtual LevelSet::Pointer CloneLevelSet() const
+    {
+        return LevelSet::Pointer(new GridLevelSet(*this));
+    }
+
+
+    virtual std::size_t WorkingSpaceDimension() const
+    {
+        return 3;
+    }
+
+
+    /// The points outside of the grid take the value of the closest boundary face, hence the domain is bounded by
+    /// the grid in a direction only if the boundary face on that side is outside
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            if(mIsFaceOutside[d][0])
+                rMin[d] = mMinPoint[d];
+            else
+                rMin[d] = -std::numeric_limits<double>::infinity();
+
+            if(mIsFaceOutside[d][1])
+                rMax[d] = mMinPoint[d] + (mNumberOfNodes[d] - 1)*mSpacing;
+            else
+                rMax[d] = std::numeric_limits<double>::infinity();
+        }
+        return true;
+    }
+
+
+    virtual double GetValue(const PointType& P) const
+    {
+        std::size_t cell[3];
+        double t[3];
+        this->LocalCoordinates(P, cell, t);
+
+        if(mOrder == 1)
+        {
+            double value = 0.0;
+            for(std::size_t a = 0; a < 2; ++a)
+            {
+                const double wa = (a == 0) ? 1.0 - t[0] : t[0];
+                for(std::size_t b = 0; b < 2; ++b)
+                {
+                    const double wb = (b == 0) ? 1.0 - t[1] : t[1];
+                    for(std::size_t c = 0; c < 2; ++c)
+                    {
+                        const double wc = (c == 0) ? 1.0 - t[2] : t[2];
+                        value += wa*wb*wc*this->NodeValue(cell[0] + a, cell[1] + b, cell[2] + c);
+                    }
+                }
+            }
+            return value;
+        }
+
+        std::size_t nodes[3][4];
+        double w[3][4], dw[3][4];
+        this->CubicStencil(cell, t, nodes, w, dw);
+
+        double value = 0.0;
+        for(std::size_t a = 0; a < 4; ++a)
+            for(std::size_t b = 0; b < 4; ++b)
+                for(std::size_t c = 0; c < 4; ++c)
+                    value += w[0][a]*w[1][b]*w[2][c]*this->NodeValue(nodes[0][a], nodes[1][b], nodes[2][c]);
+        return value;
+    }
+
+
+    /// The large batches are evaluated in parallel
+    virtual void GetValues(const PointType* P, const std::size_t n, double* Values) const
+    {
+        const int number_of_points = static_cast<int>(n);
+
+        #pragma omp parallel for if(n > 256)
+        for(int i = 0; i < number_of_points; ++i)
+            Values[i] = this->GetValue(P[i]);
+    }
+
+
+    virtual void GetGradient(const PointType& P, array_1d<double, 3>& rGradient) const
+    {
+        std::size_t cell[3];
+        double t[3];
+        this->LocalCoordinates(P, cell, t);
+
+        rGradient[0] = 0.0;
+        rGradient[1] = 0.0;
+        rGradient[2] = 0.0;
+
+        if(mOrder == 1)
+        {
+            for(std::size_t a = 0; a < 2; ++a)
+            {
+                const double wa = (a == 0) ? 1.0 - t[0] : t[0];
+                const double dwa = (a == 0) ? -1.0 : 1.0;
+                for(std::size_t b = 0; b < 2; ++b)
+                {
+                    const double wb = (b == 0) ? 1.0 - t[1] : t[1];
+                    const double dwb = (b == 0) ? -1.0 : 1.0;
+                    for(std::size_t c = 0; c < 2; ++c)
+                    {
+                        const double wc = (c == 0) ? 1.0 - t[2] : t[2];
+                        const double dwc = (c == 0) ? -1.0 : 1.0;
+                        const double phi = this->NodeValue(cell[0] + a, cell[1] + b, cell[2] + c);
+                        rGradient[0] += dwa*wb*wc*phi;
+                        rGradient[1] += wa*dwb*wc*phi;
+                        rGradient[2] += wa*wb*dwc*phi;
+                    }
+                }
+            }
+        }
+        else
+        {
+            std::size_t nodes[3][4];
+            double w[3][4], dw[3][4];
+            this->CubicStencil(cell, t, nodes, w, dw);
+
+            for(std::size_t a = 0; a < 4; ++a)
+            {
+                for(std::size_t b = 0; b < 4; ++b)
+                {
+                    for(std::size_t c = 0; c < 4; ++c)
+                    {
+                        const double phi = this->NodeValue(nodes[0][a], nodes[1][b], nodes[2][c]);
+                        rGradient[0] += dw[0][a]*w[1][b]*w[2][c]*phi;
+                        rGradient[1] += w[0][a]*dw[1][b]*w[2][c]*phi;
+                        rGradient[2] += w[0][a]*w[1][b]*dw[2][c]*phi;
+                    }
+                }
+            }
+        }
+
+        rGradient /= mSpacing;
+    }
+
+
+    ///@}
+    ///@name Access
+    ///@{
+
+
+    /// Get the total number of bricks of the grid
+    std::size_t NumberOfBricks() const
+    {
+        return mBrickIndex.size();
+    }
+
+
+    /// Get the number of bricks storing the nodal values
+    std::size_t NumberOfAllocatedBricks() const
+    {
+        return mBrickValues.size() / (BRICK_SIZE*BRICK_SIZE*BRICK_SIZE);
+    }
+
+
+    ///@}
+    ///@name Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Input and output
+    ///@{
+
+    /// Turn back information as a string.
+    virtual std::string Info() const
+    {
+        return "Grid Level Set";
+    }
+
+    /// Print information about this object.
+    virtual void PrintInfo(std::ostream& rOStream) const
+    {
+        rOStream << Info();
+    }
+
+    /// Print object's data.
+    virtual void PrintData(std::ostream& rOStream) const
+    {
+        rOStream << "Min point: " << mMinPoint << ", spacing: " << mSpacing
+                 << ", nodes: " << mNumberOfNodes[0] << "x" << mNumberOfNodes[1] << "x" << mNumberOfNodes[2]
+                 << ", band width: " << mBandWidth << ", order: " << mOrder
+                 << ", allocated bricks: " << NumberOfAllocatedBricks() << "/" << NumberOfBricks();
+    }
+
+
+    ///@}
+    ///@name Friends
+    ///@{
+
+
+    ///@}
+
+protected:
+    ///@name Protected static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Protected member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Protected Operators
+    ///@{
+
+
+    ///@}
+    ///@name Protected Operations
+    ///@{
+
+
+    ///@}
+    ///@name Protected  Access
+    ///@{
+
+
+    ///@}
+    ///@name Protected Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Protected LifeCycle
+    ///@{
+
+
+    ///@}
+
+private:
+    ///@name Static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Member Variables
+    ///@{
+
+
+    array_1d<double, 3> mMinPoint;
+    double mSpacing;
+    double mBandWidth;
+    int mOrder;
+    std::size_t mNumberOfNodes[3];
+    std::size_t mNumberOfBricks[3];
+    std::vector<int> mBrickIndex; // index of the brick in mBrickValues, or BRICK_INSIDE/BRICK_OUTSIDE if not allocated
+    std::vector<double> mBrickValues; // nodal values of the allocated bricks, BRICK_SIZE^3 per brick
+    bool mIsFaceOutside[3][2]; // the interpolation on the lower/upper boundary face of each direction is positive
+
+
+    ///@}
+    ///@name Private Operators
+    ///@{
+
+
+    ///@}
+    ///@name Private Operations
+    ///@{
+
+
+    /// Sample the level set at the nodes of each brick in parallel and keep only the bricks in the narrow band.
+    /// A brick is first screened by the value at its center: if |phi| exceeds the band width by more than the Lipschitz
+    /// bound over the half diagonal, all its nodes are out of the band on the same side and it is not sampled.
+    /// Without a Lipschitz bound, every brick is sampled.
+    void Bake(const LevelSet& rLevelSet)
+    {
+        const std::size_t nbricks = mNumberOfBricks[0]*mNumberOfBricks[1]*mNumberOfBricks[2];
+        const std::size_t brick_nodes = BRICK_SIZE*BRICK_SIZE*BRICK_SIZE;
+        const double brick_length = (BRICK_SIZE - 1)*mSpacing;
+        const double half_diagonal = 0.5*std::sqrt(3.0)*brick_length;
+
+        mBrickIndex.resize(nbricks);
+        std::vector<std::vector<double> > Values(nbricks);
+
+        #pragma omp parallel for schedule(dynamic)
+        for(int ib = 0; ib < static_cast<int>(nbricks); ++ib)
+        {
+            const std::size_t b = static_cast<std::size_t>(ib);
+            const std::size_t bi = b / (mNumberOfBricks[1]*mNumberOfBricks[2]);
+            const std::size_t bj = (b / mNumberOfBricks[2]) % mNumberOfBricks[1];
+            const std::size_t bk = b % mNumberOfBricks[2];
+
+            PointType BrickMin, BrickMax, Center;
+            BrickMin[0] = mMinPoint[0] + bi*BRICK_SIZE*mSpacing;
+            BrickMin[1] = mMinPoint[1] + bj*BRICK_SIZE*mSpacing;
+            BrickMin[2] = mMinPoint[2] + bk*BRICK_SIZE*mSpacing;
+            for(std::size_t d = 0; d < 3; ++d)
+            {
+                BrickMax[d] = BrickMin[d] + brick_length;
+                Center[d] = BrickMin[d] + 0.5*brick_length;
+            }
+
+            const double L = rLevelSet.GetLipschitzConstant(BrickMin, BrickMax);
+            if(L*half_diagonal < std::numeric_limits<double>::infinity())
+            {
+                const double center_value = rLevelSet.GetValue(Center);
+                if(std::fabs(center_value) > mBandWidth + L*half_diagonal)
+                {
+                    mBrickIndex[b] = (center_value < 0.0) ? BRICK_INSIDE : BRICK_OUTSIDE;
+                    continue;
+                }
+            }
+
+            std::vector<PointType> Points(brick_nodes);
+            for(std::size_t i = 0; i < BRICK_SIZE; ++i)
+            {
+                for(std::size_t j = 0; j < BRICK_SIZE; ++j)
+                {
+                    for(std::size_t k = 0; k < BRICK_SIZE; ++k)
+                    {
+                        PointType& rP = Points[(i*BRICK_SIZE + j)*BRICK_SIZE + k];
+                        rP[0] = mMinPoint[0] + (bi*BRICK_SIZE + i)*mSpacing;
+                        rP[1] = mMinPoint[1] + (bj*BRICK_SIZE + j)*mSpacing;
+                        rP[2] = mMinPoint[2] + (bk*BRICK_SIZE + k)*mSpacing;
+                    }
+                }
+            }
+
+            std::vector<double> BrickValues(brick_nodes);
+            rLevelSet.GetValues(&Points[0], brick_nodes, &BrickValues[0]);
+
+            bool in_band = false, has_inside = false, has_outside = false;
+            for(std::size_t i = 0; i < brick_nodes; ++i)
+            {
+                if(std::fabs(BrickValues[i]) <= mBandWidth)
+                    in_band = true;
+                if(BrickValues[i] < 0.0)
+                    has_inside = true;
+                else
+                    has_outside = true;
+            }
+
+            if(in_band || (has_inside && has_outside))
+                Values[b].swap(BrickValues);
+            else
+                mBrickIndex[b] = has_inside ? BRICK_INSIDE : BRICK_OUTSIDE;
+        }
+
+        std::size_t nallocated = 0;
+        for(std::size_t b = 0; b < nbricks; ++b)
+            if(!Values[b].empty())
+                mBrickIndex[b] = static_cast<int>(nallocated++);
+
+        mBrickValues.resize(nallocated*brick_nodes);
+        for(std::size_t b = 0; b < nbricks; ++b)
+            if(!Values[b].empty())
+                std::copy(Values[b].begin(), Values[b].end(), mBrickValues.begin() + mBrickIndex[b]*brick_nodes);
+
+        this->ComputeOutsideFaces();
+    }
+
+
+    /// Check which boundary faces of the grid are outside, i.e. the interpolated value is positive everywhere on the face.
+    /// The face is interpolated from its own nodes. The trilinear interpolation is a convex combination of them. The
+    /// negative Catmull-Rom weights sum to at most 1/8 in each direction, hence to at most 0.28125 on a face.
+    void ComputeOutsideFaces()
+    {
+        const double undershoot = (mOrder == 1) ? 0.0 : 0.28125;
+
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            const std::size_t d1 = (d + 1) % 3;
+            const std::size_t d2 = (d + 2) % 3;
+            for(std::size_t side = 0; side < 2; ++side)
+            {
+                double vmin = std::numeric_limits<double>::max();
+                double vmax = -std::numeric_limits<double>::max();
+                std::size_t node[3];
+                node[d] = (side == 0) ? 0 : mNumberOfNodes[d] - 1;
+                for(node[d1] = 0; node[d1] < mNumberOfNodes[d1]; ++node[d1])
+                {
+                    for(node[d2] = 0; node[d2] < mNumberOfNodes[d2]; ++node[d2])
+                    {
+                        const double v = this->NodeValue(node[0], node[1], node[2]);
+                        vmin = std::min(vmin, v);
+                        vmax = std::max(vmax, v);
+                    }
+                }
+                mIsFaceOutside[d][side] = (vmin - undershoot*(vmax - vmin) >= 0.0);
+            }
+        }
+    }
+
+
+    /// Get the value at node (i, j, k) of the grid
+    double NodeValue(const std::size_t i, const std::size_t j, const std::size_t k) const
+    {
+        const std::size_t b = ((i / BRICK_SIZE)*mNumberOfBricks[1] + j / BRICK_SIZE)*mNumberOfBricks[2] + k / BRICK_SIZE;
+        const int index = mBrickIndex[b];
+
+        if(index == BRICK_INSIDE)
+            return -mBandWidth;
+        else if(index == BRICK_OUTSIDE)
+            return mBandWidth;
+
+        const std::size_t local = ((i % BRICK_SIZE)*BRICK_SIZE + j % BRICK_SIZE)*BRICK_SIZE + k % BRICK_SIZE;
+        return mBrickValues[index*BRICK_SIZE*BRICK_SIZE*BRICK_SIZE + local];
+    }
+
+
+    /// Compute the cell containing the point and the local coordinates in [0, 1] within the cell.
+    /// The point is clamped to the grid.
+    void LocalCoordinates(const PointType& P, std::size_t* cell, double* t) const
+    {
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            const double x = (P[d] - mMinPoint[d]) / mSpacing;
+            const double xmax = static_cast<double>(mNumberOfNodes[d] - 1);
+
+            if(x <= 0.0)
+            {
+                cell[d] = 0;
+                t[d] = 0.0;
+            }
+            else if(x >= xmax)
+            {
+                cell[d] = mNumberOfNodes[d] - 2;
+                t[d] = 1.0;
+            }
+            else
+            {
+                cell[d] = std::min(static_cast<std::size_t>(x), mNumberOfNodes[d] - 2);
+                t[d] = x - cell[d];
+            }
+        }
+    }
+
+
+    /// Compute the nodes and the Catmull-Rom weights (and their derivatives w.r.t t) of the tricubic interpolation.
+    /// The nodes outside of the grid are clamped to the boundary.
+    void CubicStencil(const std::size_t* cell, const double* t, std::size_t nodes[3][4], double w[3][4], double dw[3][4]) const
+    {
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            const double s = t[d];
+            const double s2 = s*s;
+            const double s3 = s2*s;
+
+            w[d][0] = 0.5*(-s + 2.0*s2 - s3);
+            w[d][1] = 0.5*(2.0 - 5.0*s2 + 3.0*s3);
+            w[d][2] = 0.5*(s + 4.0*s2 - 3.0*s3);
+            w[d][3] = 0.5*(-s2 + s3);
+
+            dw[d][0] = 0.5*(-1.0 + 4.0*s - 3.0*s2);
+            dw[d][1] = 0.5*(-10.0*s + 9.0*s2);
+            dw[d][2] = 0.5*(1.0 + 8.0*s - 9.0*s2);
+            dw[d][3] = 0.5*(-2.0*s + 3.0*s2);
+
+            nodes[d][0] = (cell[d] == 0) ? 0 : cell[d] - 1;
+            nodes[d][1] = cell[d];
+            nodes[d][2] = cell[d] + 1;
+            nodes[d][3] = std::min(cell[d] + 2, mNumberOfNodes[d] - 1);
+        }
+    }
+
+
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("MinPoint", mMinPoint);
+        rSerializer.save("Spacing", mSpacing);
+        rSerializer.save("BandWidth", mBandWidth);
+        rSerializer.save("Order", mOrder);
+        rSerializer.save("NumberOfNodesX", mNumberOfNodes[0]);
+        rSerializer.save("NumberOfNodesY", mNumberOfNodes[1]);
+        rSerializer.save("NumberOfNodesZ", mNumberOfNodes[2]);
+        rSerializer.save("NumberOfBricksX", mNumberOfBricks[0]);
+        rSerializer.save("NumberOfBricksY", mNumberOfBricks[1]);
+        rSerializer.save("NumberOfBricksZ", mNumberOfBricks[2]);
+        rSerializer.save("BrickIndex", mBrickIndex);
+        rSerializer.save("BrickValues", mBrickValues);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("MinPoint", mMinPoint);
+        rSerializer.load("Spacing", mSpacing);
+        rSerializer.load("BandWidth", mBandWidth);
+        rSerializer.load("Order", mOrder);
+        rSerializer.load("NumberOfNodesX", mNumberOfNodes[0]);
+        rSerializer.load("NumberOfNodesY", mNumberOfNodes[1]);
+        rSerializer.load("NumberOfNodesZ", mNumberOfNodes[2]);
+        rSerializer.load("NumberOfBricksX", mNumberOfBricks[0]);
+        rSerializer.load("NumberOfBricksY", mNumberOfBricks[1]);
+        rSerializer.load("NumberOfBricksZ", mNumberOfBricks[2]);
+        rSerializer.load("BrickIndex", mBrickIndex);
+        rSerializer.load("BrickValues", mBrickValues);
+        this->ComputeOutsideFaces();
+    }
+
+    ///@}
+    ///@name Private  Access
+    ///@{
+
+
+    ///@}
+    ///@name Private Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Un accessible methods
+    ///@{
+
+    /// Assignment operator.
+    GridLevelSet& operator=(GridLevelSet const& rOther);
+
+    ///@}
+
+}; // Class GridLevelSet
+
+///@}
+
+///@name Type Definitions
+///@{
+
+
+///@}
+///@name Input and output
+///@{
+
+
+/// input stream function
+inline std::istream& operator >> (std::istream& rIStream, GridLevelSet& rThis)
+{}
+
+/// output stream function
+inline std::ostream& operator << (std::ostream& rOStream, const GridLevelSet& rThis)
+{
+    rThis.PrintInfo(rOStream);
+    rOStream << std::endl;
+    rThis.PrintData(rOStream);
+
+    return rOStream;
+}
+///@}
+
+///@} addtogroup block
+
+}  // namespace Kratos.
+
+#endif // KRATOS_GRID_LEVEL_SET_H_INCLUDED  defined
@@ -88,6 +88,10 @@ public:
     : BaseType(), mp_level_set(p_level_set)
     {}
 
+    /// Default constructor, only used by the serializer.
+    InverseLevelSet() : BaseType()
+    {}
+
     /// Copy constructor.
     InverseLevelSet(InverseLevelSet const& rOther)
     : BaseType(rOther), mp_level_set(rOther.mp_level_set->CloneLevelSet())
@@ -119,15 +123,54 @@ public:
     }
 
 
+    /// The inside and the outside of the level set are swapped. The bounding box of the complement of a bounded
+    /// domain is unknown, hence the default GetBoundingBox is kept.
+    virtual int CutStatusOfBox(const PointType& rMin, const PointType& rMax) const
+    {
+        const int stat = mp_level_set->CutStatusOfBox(rMin, rMax);
+        if(stat == BRep::_IN)
+            return BRep::_OUT;
+        if(stat == BRep::_OUT)
+            return BRep::_IN;
+        return BRep::_CUT;
+    }
+
+
     virtual double GetValue(const PointType& P) const
     {
         return -mp_level_set->GetValue(P);
     }
 
 
-    virtual Vector GetGradient(const PointType& P) const
+    virtual void GetValues(const PointType* P, const std::size_t n, double* Values) const
+    {
+        mp_level_set->GetValues(P, n, Values);
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = -Values[i];
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        typedef FunctionTape<InputType, OutputType> TapeType;
+        return rTape.AddUnary(TapeType::NEGATE, mp_level_set->Compile(rTape));
+    }
+
+
+    virtual void GetGradient(const PointType& P, array_1d<double, 3>& rGradient) const
     {
-        return -mp_level_set->GetGradient(P);
+        mp_level_set->GetGradient(P, rGradient);
+        rGradient *= -1.0;
+    }
+
+
+    virtual void GetValueGradientHessian(const PointType& P, double& rValue, array_1d<double, 3>& rGradient,
+            bounded_matrix<double, 3, 3>& rHessian) const
+    {
+        mp_level_set->GetValueGradientHessian(P, rValue, rGradient, rHessian);
+        rValue = -rValue;
+        noalias(rGradient) = -rGradient;
+        noalias(rHessian) = -rHessian;
     }
 
 
@@ -206,6 +249,12 @@ protected:
     ///@{
 
 
+    virtual double ComputeLipschitzConstant(const PointType& rMin, const PointType& rMax) const
+    {
+        return mp_level_set->GetLipschitzConstant(rMin, rMax);
+    }
+
+
     ///@}
     ///@name Protected  Access
     ///@{
@@ -242,6 +291,19 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("LevelSet", mp_level_set);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("LevelSet", mp_level_set);
+    }
 
     ///@}
     ///@name Private  Access
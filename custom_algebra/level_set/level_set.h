@@ -19,6 +19,7 @@
 
 // System includes
 #include <string>
+#include <limits>
 #include <iostream>
 
 
@@ -90,10 +91,10 @@ public:
     ///@{
 
     /// Default constructor.
-    LevelSet() : BRep(), BaseType() {}
+    LevelSet() : BRep(), BaseType(), mLipschitzConstant(-1.0) {}
 
     /// Copy constructor.
-    LevelSet(LevelSet const& rOther) : BRep(rOther), BaseType(rOther) {}
+    LevelSet(LevelSet const& rOther) : BRep(rOther), BaseType(rOther), mLipschitzConstant(rOther.mLipschitzConstant) {}
 
     /// Destructor.
     virtual ~LevelSet() {}
@@ -158,6 +159,40 @@ public:
     }
 
 
+    /// Evaluate the level set at a batch of n points. The composite level sets shall override this
+    /// to evaluate each operand once over the whole batch.
+    virtual void GetValues(const PointType* P, const std::size_t n, double* Values) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = this->GetValue(P[i]);
+    }
+
+
+    /// inherit from Function
+    /// This is an adapter to GetValue on PointType, which is called when the level set is evaluated as a FunctionR3R1,
+    /// e.g. as an opaque call in a compiled function
+    virtual double GetValue(const InputType& P) const
+    {
+        PointType Q;
+        noalias(Q) = P;
+        return this->GetValue(Q);
+    }
+
+
+    /// inherit from Function
+    /// This is an adapter to the batched GetValues on PointType
+    virtual void GetValues(const InputType* P, const std::size_t n, double* Values) const
+    {
+        if(n == 0)
+            return;
+
+        std::vector<PointType> Q(n);
+        for(std::size_t i = 0; i < n; ++i)
+            noalias(Q[i]) = P[i];
+        this->GetValues(&Q[0], n, Values);
+    }
+
+
 //    virtual double GetValue(GeometryType& rGeometry, const CoordinatesArrayType& rLocalPoint) const
 //    {
 //        KRATOS_THROW_ERROR(std::logic_error, "Calling the base class", __FUNCTION__)
@@ -174,25 +209,107 @@ public:
 
 
     /// inherit from Function
+    /// This is an adapter of the fixed-size GetGradient, which shall be overridden by the level sets
     virtual Vector GetGradient(const PointType& P) const
+    {
+        array_1d<double, 3> G;
+        this->GetGradient(P, G);
+        return G;
+    }
+
+
+    /// Compute the gradient at a point, without heap allocation
+    virtual void GetGradient(const PointType& P, array_1d<double, 3>& rGradient) const
     {
         KRATOS_THROW_ERROR(std::logic_error, "Calling the base class", __FUNCTION__)
     }
 
 
+    /// inherit from Function
+    /// This is an adapter to the fixed-size GetGradient on PointType
+    virtual void GetGradient(const InputType& P, GradientType& rGradient) const
+    {
+        PointType Q;
+        noalias(Q) = P;
+        this->GetGradient(Q, rGradient);
+    }
+
+
+    /// Compute the gradients at a batch of n points. The level sets with a cheaper batched evaluation shall override this.
+    virtual void GetGradients(const PointType* P, const std::size_t n, array_1d<double, 3>* Gradients) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            this->GetGradient(P[i], Gradients[i]);
+    }
+
+
+    /// inherit from Function
+    /// This is an adapter to the batched GetGradients on PointType
+    virtual void GetGradients(const InputType* P, const std::size_t n, GradientType* Gradients) const
+    {
+        if(n == 0)
+            return;
+
+        std::vector<PointType> Q(n);
+        for(std::size_t i = 0; i < n; ++i)
+            noalias(Q[i]) = P[i];
+        this->GetGradients(&Q[0], n, Gradients);
+    }
+
+
     /// compute the derivatives of the gradient w.r.t the global point
+    /// This is an adapter of the fixed-size GetGradientDerivatives, which shall be overridden by the level sets
     virtual Matrix GetGradientDerivatives(const PointType& P) const
+    {
+        bounded_matrix<double, 3, 3> Jac;
+        this->GetGradientDerivatives(P, Jac);
+        return Jac;
+    }
+
+
+    /// compute the derivatives of the gradient w.r.t the global point, without heap allocation
+    virtual void GetGradientDerivatives(const PointType& P, bounded_matrix<double, 3, 3>& rDerivatives) const
     {
         KRATOS_THROW_ERROR(std::logic_error, "Calling the base class", __FUNCTION__)
     }
 
 
+    /// Compute the value, the gradient and the Hessian (derivatives of the gradient) at a point at once.
+    /// The level sets shall override this to share the intermediate quantities between the three; by default they are
+    /// computed separately by GetValue and the fixed-size GetGradient and GetGradientDerivatives.
+    virtual void GetValueGradientHessian(const PointType& P, double& rValue, array_1d<double, 3>& rGradient,
+            bounded_matrix<double, 3, 3>& rHessian) const
+    {
+        rValue = this->GetValue(P);
+        this->GetGradient(P, rGradient);
+        this->GetGradientDerivatives(P, rHessian);
+    }
+
+
 //    virtual Vector GetGradient(GeometryType& rGeometry, const CoordinatesArrayType& rLocalPoint) const
 //    {
 //        KRATOS_THROW_ERROR(std::logic_error, "Calling the base class", __FUNCTION__)
 //    }
 
 
+    /// Set the Lipschitz constant L of the level set, i.e. |phi(x) - phi(y)| <= L |x - y|, for a level set whose
+    /// constant is not known by the library. It takes precedence over the computed one; a negative value restores it.
+    void SetLipschitzConstant(const double& L)
+    {
+        mLipschitzConstant = L;
+    }
+
+
+    /// Get an upper bound of the Lipschitz constant of the level set within the box [rMin, rMax]
+    /// Return infinity if no bound is known.
+    double GetLipschitzConstant(const PointType& rMin, const PointType& rMax) const
+    {
+        if(mLipschitzConstant >= 0.0)
+            return mLipschitzConstant;
+        return this->ComputeLipschitzConstant(rMin, rMax);
+    }
+
+
     /// inherit from BRep
     virtual bool IsInside(const PointType& P) const
     {
@@ -220,7 +337,10 @@ public:
         }
         else if (configuration == 1)
         {
-            return CutStatusOfPoints(r_geom, this->GetTolerance());
+            std::vector<PointType> points(r_geom.size());
+            for (std::size_t i = 0; i < r_geom.size(); ++i)
+                noalias(points[i]) = r_geom[i].Coordinates();
+            return CutStatusOfPoints(points, this->GetTolerance());
             // REMARK: this will use the current position of node, e.g. in dynamics
         }
     }
@@ -234,6 +354,18 @@ public:
     }
 
 
+    /// inherit from BRep
+    /// The box is classified from the bounding box of the level set, then from the Lipschitz bound
+    virtual int CutStatusOfBoxByBounds(const PointType& rMin, const PointType& rMax) const
+    {
+        const int box_stat = this->CutStatusOfBox(rMin, rMax);
+        if(box_stat != BRep::_CUT)
+            return box_stat;
+
+        return this->CutStatusOfLipschitzBound(rMin, rMax, 0.5*norm_2(rMax - rMin), this->GetTolerance());
+    }
+
+
     /// inherit from BRep
     /// Compute the intersection of the level set with a line connect by 2 points.
     /// Note that, the checking of the intersection of the level set with the line is not performed. Hence one should ensure that before calling this function.
@@ -284,17 +416,19 @@ public:
     /// inherit from BRep
     virtual void GetNormal(const PointType& P, PointType& rNormal) const
     {
-        Vector G = this->GetGradient(P);
-        noalias(rNormal) = ZeroVector(3);
-        for (std::size_t i = 0; i < G.size(); ++i)
-            rNormal[i] = G(i);
+        array_1d<double, 3> G;
+        this->GetGradient(P, G);
+        noalias(rNormal) = G;
     }
 
 
     /// inherit from BRep
     virtual void GetNormalDerivatives(const PointType& P, Matrix& Derivatives) const
     {
-        Derivatives = this->GetGradientDerivatives(P);
+        bounded_matrix<double, 3, 3> Jac;
+        this->GetGradientDerivatives(P, Jac);
+        Derivatives.resize(3, 3, false);
+        noalias(Derivatives) = Jac;
     }
 
 
@@ -314,6 +448,36 @@ public:
         KRATOS_THROW_ERROR(std::logic_error, "Calling the base class", __FUNCTION__)
     }
 
+
+    /// Save a BRep given by pointer. A level set is saved through the LevelSet pointer: its BRep part is not
+    /// at the address of the object, hence the serializer can't create it from a BRep pointer.
+    static void SaveBRep(Serializer& rSerializer, const std::string& rTag, const BRep::Pointer& pBRep)
+    {
+        LevelSet::Pointer pLevelSet = boost::dynamic_pointer_cast<LevelSet>(pBRep);
+        const bool is_level_set = (pLevelSet.get() != NULL);
+        rSerializer.save(rTag + "IsLevelSet", is_level_set);
+        if(is_level_set)
+            rSerializer.save(rTag, pLevelSet);
+        else
+            rSerializer.save(rTag, pBRep);
+    }
+
+
+    /// Load a BRep saved by SaveBRep. A level set is loaded in pLevelSet, which must live as long as the
+    /// serializer, since the other references to the same level set are resolved from it.
+    static void LoadBRep(Serializer& rSerializer, const std::string& rTag, BRep::Pointer& pBRep, LevelSet::Pointer& pLevelSet)
+    {
+        bool is_level_set;
+        rSerializer.load(rTag + "IsLevelSet", is_level_set);
+        if(is_level_set)
+        {
+            rSerializer.load(rTag, pLevelSet);
+            pBRep = pLevelSet;
+        }
+        else
+            rSerializer.load(rTag, pBRep);
+    }
+
     ///@}
     ///@name Access
     ///@{
@@ -373,6 +537,14 @@ protected:
     ///@{
 
 
+    /// Compute an upper bound of the Lipschitz constant of the level set within the box [rMin, rMax]
+    /// The level sets knowing their bound shall override this; by default it is unknown, i.e. infinite.
+    virtual double ComputeLipschitzConstant(const PointType& rMin, const PointType& rMax) const
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+
     ///@}
     ///@name Protected  Access
     ///@{
@@ -400,6 +572,9 @@ private:
     ///@{
 
 
+    double mLipschitzConstant; // set by the user, negative if it is not set
+
+
     ///@}
     ///@name Private Operators
     ///@{
@@ -409,17 +584,44 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
 
-    template<class TPointsContainerType>
-    int CutStatusOfPoints(const TPointsContainerType& r_points, const double& tolerance) const
+    virtual void save(Serializer& rSerializer) const
     {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BRep)
+        rSerializer.save("LipschitzConstant", mLipschitzConstant);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BRep)
+        rSerializer.load("LipschitzConstant", mLipschitzConstant);
+    }
+
+
+    int CutStatusOfPoints(const std::vector<PointType>& r_points, const double& tolerance) const
+    {
+        // the points disjoint from the level set are classified without evaluating the level set
+        const int box_stat = this->CutStatusOfBoundingBox(r_points);
+        if(box_stat != BRep::_CUT)
+            return box_stat;
+
+        const int lipschitz_stat = this->CutStatusOfLipschitzBound(r_points, tolerance);
+        if(lipschitz_stat != BRep::_CUT)
+            return lipschitz_stat;
+
+        std::vector<double> phi(r_points.size());
+        if(r_points.size() != 0)
+            this->GetValues(&r_points[0], r_points.size(), &phi[0]);
+
         std::vector<std::size_t> in_list, out_list, on_list;
         for(std::size_t v = 0; v < r_points.size(); ++v)
         {
-            double phi = this->GetValue(r_points[v]);
-            if(phi < -tolerance)
+            if(phi[v] < -tolerance)
                 in_list.push_back(v);
-            else if(phi > tolerance)
+            else if(phi[v] > tolerance)
                 out_list.push_back(v);
             else
                 on_list.push_back(v);
@@ -458,6 +660,49 @@ private:
     }
 
 
+    /// Classify a set of points from a single evaluation at the center of their bounding box, see below.
+    int CutStatusOfLipschitzBound(const std::vector<PointType>& r_points, const double& tolerance) const
+    {
+        if(r_points.size() == 0)
+            return BRep::_CUT;
+
+        PointType Min, Max;
+        ComputeBoundingBox(r_points, Min, Max);
+
+        PointType Center;
+        for(std::size_t d = 0; d < 3; ++d)
+            Center[d] = 0.5*(Min[d] + Max[d]);
+
+        double radius = 0.0;
+        for(std::size_t v = 0; v < r_points.size(); ++v)
+            radius = std::max(radius, norm_2(r_points[v] - Center));
+
+        return this->CutStatusOfLipschitzBound(Min, Max, radius, tolerance);
+    }
+
+
+    /// Classify the points within the distance radius from the center of the box [rMin, rMax] from a single evaluation
+    /// at the center. The level set can't change its sign within the distance |phi(center)| / L from the center, with
+    /// L the Lipschitz constant. Return _CUT if it can't be decided this way.
+    int CutStatusOfLipschitzBound(const PointType& rMin, const PointType& rMax, const double& radius, const double& tolerance) const
+    {
+        const double L = this->GetLipschitzConstant(rMin, rMax);
+        if(!(L < std::numeric_limits<double>::infinity()))
+            return BRep::_CUT;
+
+        PointType Center;
+        for(std::size_t d = 0; d < 3; ++d)
+            Center[d] = 0.5*(rMin[d] + rMax[d]);
+
+        const double phi = this->GetValue(Center);
+        if(phi - L*radius > tolerance)
+            return BRep::_OUT;
+        if(phi + L*radius < -tolerance)
+            return BRep::_IN;
+        return BRep::_CUT;
+    }
+
+
     ///@}
     ///@name Private  Access
     ///@{
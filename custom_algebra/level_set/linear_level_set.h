@@ -77,6 +77,10 @@ public:
     : BaseType(), mA(A), mB(B), mC(C)
     {}
 
+    /// Default constructor, only used by the serializer.
+    LinearLevelSet() : BaseType(), mA(0.0), mB(0.0), mC(0.0)
+    {}
+
     /// Copy constructor.
     LinearLevelSet(LinearLevelSet const& rOther)
     : BaseType(rOther), mA(rOther.mA), mB(rOther.mB), mC(rOther.mC)
@@ -108,18 +112,68 @@ public:
     }
 
 
+    /// The half plane is bounded in one direction only if the line is normal to an axis
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        if((mA != 0.0) == (mB != 0.0))
+            return false;
+
+        for(int d = 0; d < 3; ++d)
+        {
+            rMin[d] = -std::numeric_limits<double>::infinity();
+            rMax[d] = std::numeric_limits<double>::infinity();
+        }
+
+        const int axis = (mA != 0.0) ? 0 : 1;
+        const double c = (axis == 0) ? mA : mB;
+        if(c > 0.0)
+            rMax[axis] = -mC / c;
+        else
+            rMin[axis] = -mC / c;
+
+        return true;
+    }
+
+
     virtual double GetValue(const PointType& P) const
     {
         return mA*P(0) + mB*P(1) + mC;
     }
 
 
-    virtual Vector GetGradient(const PointType& P) const
+    virtual void GetValues(const PointType* P, const std::size_t n, double* Values) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = mA*P[i][0] + mB*P[i][1] + mC;
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        typedef FunctionTape<InputType, OutputType> TapeType;
+        std::size_t v = rTape.AddBinary(TapeType::ADD, rTape.AddUnary(TapeType::SCALE, rTape.AddVariable(0), mA), rTape.AddUnary(TapeType::SCALE, rTape.AddVariable(1), mB));
+        return rTape.AddBinary(TapeType::ADD, v, rTape.AddConstant(mC));
+    }
+
+
+    virtual void GetGradient(const PointType& P, array_1d<double, 3>& rGradient) const
+    {
+        rGradient[0] = mA;
+        rGradient[1] = mB;
+        rGradient[2] = 0.0;
+    }
+
+
+    virtual void GetValueGradientHessian(const PointType& P, double& rValue, array_1d<double, 3>& rGradient,
+            bounded_matrix<double, 3, 3>& rHessian) const
     {
-        Vector grad(2);
-        grad(0) = mA;
-        grad(1) = mB;
-        return grad;
+        rValue = mA*P(0) + mB*P(1) + mC;
+
+        rGradient[0] = mA;
+        rGradient[1] = mB;
+        rGradient[2] = 0.0;
+
+        noalias(rHessian) = ZeroMatrix(3, 3);
     }
 
 
@@ -180,6 +234,12 @@ protected:
     ///@{
 
 
+    virtual double ComputeLipschitzConstant(const PointType& rMin, const PointType& rMax) const
+    {
+        return std::sqrt(mA*mA + mB*mB);
+    }
+
+
     ///@}
     ///@name Protected  Access
     ///@{
@@ -219,6 +279,23 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("A", mA);
+        rSerializer.save("B", mB);
+        rSerializer.save("C", mC);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("A", mA);
+        rSerializer.load("B", mB);
+        rSerializer.load("C", mC);
+    }
 
     ///@}
     ///@name Private  Access
@@ -0,0 +1,345 @@
+//    |  /           |
+//    ' /   __| _` | __|  _ \   __|
+//    . \  |   (   | |   (   |\__ `
+//   _|\_\_|  \__,_|\__|\___/ ____/
+//                   Multi-Physics
+//
+//  License:         brep_application/LICENSE.txt
+//                   Kratos default license: kratos/license.txt
+//
+//  Main authors:    Hoang-Giang Bui
+//  Date:            16 Oct 2026
+//
+
+
+#if !defined(KRATOS_NARY_INTERSECTION_LEVEL_SET_H_INCLUDED )
+#define  KRATOS_NARY_INTERSECTION_LEVEL_SET_H_INCLUDED
+
+
+
+// System includes
+#include <string>
+#include <limits>
+#include <iostream>
+
+
+// External includes
+
+
+// Project includes
+#include "includes/define.h"
+#include "custom_algebra/level_set/nary_level_set.h"
+
+
+namespace Kratos
+{
+///@addtogroup BRepApplication
+///@{
+
+///@name Kratos Globals
+///@{
+
+///@}
+///@name Type Definitions
+///@{
+
+///@}
+///@name  Enum's
+///@{
+
+///@}
+///@name  Functions
+///@{
+
+///@}
+///@name Kratos Classes
+///@{
+
+/// Short class definition.
+/** Class for intersection of an arbitrary number of level sets, i.e. the maximum of the operands. A point outside of
+ * the bounding box of an operand is outside of the intersection, hence only this operand is evaluated. Its value
+ * is positive but may be smaller than the maximum.
+*/
+class NaryIntersectionLevelSet : public NaryLevelSet
+{
+public:
+    ///@name Type Definitions
+    ///@{
+
+    /// Pointer definition of NaryIntersectionLevelSet
+    KRATOS_CLASS_POINTER_DEFINITION(NaryIntersectionLevelSet);
+
+    typedef NaryLevelSet BaseType;
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// Default constructor.
+    NaryIntersectionLevelSet(const std::vector<LevelSet::Pointer>& pLevelSets)
+    : BaseType(pLevelSets)
+    {}
+
+    /// Default constructor, also used by the serializer. The operands are added by AddLevelSet.
+    NaryIntersectionLevelSet() : BaseType()
+    {}
+
+    /// Copy constructor.
+    NaryIntersectionLevelSet(NaryIntersectionLevelSet const& rOther)
+    : BaseType(rOther)
+    {}
+
+    /// Destructor.
+    virtual ~NaryIntersectionLevelSet() {}
+
+
+    ///@}
+    ///@name Operators
+    ///@{
+
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+
+    virtual LevelSet::Pointer CloneLevelSet() const
+    {
+        return LevelSet::Pointer(new NaryIntersectionLevelSet(*this));
+    }
+
+
+    /// The intersection is bounded by the intersection of the bounding boxes of the operands
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        if(mUnbounded.size() == mpLevelSets.size())
+            return false;
+
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            rMin[d] = -std::numeric_limits<double>::infinity();
+            rMax[d] = std::numeric_limits<double>::infinity();
+        }
+
+        for(std::size_t i = 0; i < mpLevelSets.size(); ++i)
+        {
+            for(std::size_t d = 0; d < 3; ++d)
+            {
+                rMin[d] = std::max(rMin[d], mMin[i][d]);
+                rMax[d] = std::min(rMax[d], mMax[i][d]);
+            }
+        }
+        return true;
+    }
+
+
+    /// The box is outside if it is disjoint from the bounding box of an operand, otherwise all the operands are checked
+    virtual int CutStatusOfBox(const PointType& rMin, const PointType& rMax) const
+    {
+        if(this->FindDisjoint(rMin, rMax) != NONE)
+            return BRep::_OUT;
+
+        bool is_in = true;
+        for(std::size_t i = 0; i < mpLevelSets.size(); ++i)
+        {
+            const int stat = mpLevelSets[i]->CutStatusOfBox(rMin, rMax);
+            if(stat == BRep::_OUT)
+                return BRep::_OUT;
+            if(stat == BRep::_CUT)
+                is_in = false;
+        }
+
+        return is_in ? BRep::_IN : BRep::_CUT;
+    }
+
+
+    ///@}
+    ///@name Access
+    ///@{
+
+
+    ///@}
+    ///@name Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Input and output
+    ///@{
+
+    /// Turn back information as a string.
+    virtual std::string Info() const
+    {
+        return "N-ary Intersection Level Set";
+    }
+
+    /// Print information about this object.
+    virtual void PrintInfo(std::ostream& rOStream) const
+    {
+        rOStream << Info();
+    }
+
+    /// Print object's data.
+    virtual void PrintData(std::ostream& rOStream) const
+    {
+        BaseType::PrintData(rOStream);
+    }
+
+
+    ///@}
+    ///@name Friends
+    ///@{
+
+
+    ///@}
+
+protected:
+    ///@name Protected static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Protected member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Protected Operators
+    ///@{
+
+
+    ///@}
+    ///@name Protected Operations
+    ///@{
+
+
+    /// The point is outside of the intersection if it is outside of the bounding box of an operand; the value of
+    /// this operand is taken then. Otherwise all the operands are evaluated.
+    virtual std::size_t FindActiveLevelSet(const PointType& P, double& rValue) const
+    {
+        this->CheckNotEmpty();
+
+        std::size_t index = this->FindExcluding(P);
+        if(index != NONE)
+        {
+            rValue = mpLevelSets[index]->GetValue(P);
+            return index;
+        }
+
+        rValue = mpLevelSets[0]->GetValue(P);
+        index = 0;
+        for(std::size_t i = 1; i < mpLevelSets.size(); ++i)
+        {
+            const double v = mpLevelSets[i]->GetValue(P);
+            if(v > rValue)
+            {
+                rValue = v;
+                index = i;
+            }
+        }
+        return index;
+    }
+
+
+    ///@}
+    ///@name Protected  Access
+    ///@{
+
+
+    ///@}
+    ///@name Protected Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Protected LifeCycle
+    ///@{
+
+
+    ///@}
+
+private:
+    ///@name Static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Private Operators
+    ///@{
+
+
+    ///@}
+    ///@name Private Operations
+    ///@{
+
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+    }
+
+    ///@}
+    ///@name Private  Access
+    ///@{
+
+
+    ///@}
+    ///@name Private Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Un accessible methods
+    ///@{
+
+    /// Assignment operator.
+    NaryIntersectionLevelSet& operator=(NaryIntersectionLevelSet const& rOther);
+
+    ///@}
+
+}; // Class NaryIntersectionLevelSet
+
+///@}
+
+///@name Type Definitions
+///@{
+
+
+///@}
+///@name Input and output
+///@{
+
+
+/// input stream function
+inline std::istream& operator >> (std::istream& rIStream, NaryIntersectionLevelSet& rThis)
+{
+    return rIStream;
+}
+
+/// output stream function
+inline std::ostream& operator << (std::ostream& rOStream, const NaryIntersectionLevelSet& rThis)
+{
+    rThis.PrintInfo(rOStream);
+    rOStream << std::endl;
+    rThis.PrintData(rOStream);
+
+    return rOStream;
+}
+///@}
+
+///@} addtogroup block
+
+}  // namespace Kratos.
+
+#endif // KRATOS_NARY_INTERSECTION_LEVEL_SET_H_INCLUDED  defined
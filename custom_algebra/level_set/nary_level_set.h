@@ -0,0 +1,737 @@
+//    |  /           |
+//    ' /   __| _` | __|  _ \   __|
+//    . \  |   (   | |   (   |\__ `
+//   _|\_\_|  \__,_|\__|\___/ ____/
+//                   Multi-Physics
+//
+//  License:         brep_application/LICENSE.txt
+//                   Kratos default license: kratos/license.txt
+//
+//  Main authors:    Hoang-Giang Bui
+//  Date:            16 Oct 2026
+//
+
+
+#if !defined(KRATOS_NARY_LEVEL_SET_H_INCLUDED )
+#define  KRATOS_NARY_LEVEL_SET_H_INCLUDED
+
+
+
+// System includes
+#include <string>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <iostream>
+
+
+// External includes
+
+
+// Project includes
+#include "includes/define.h"
+#include "custom_algebra/level_set/level_set.h"
+
+
+namespace Kratos
+{
+///@addtogroup BRepApplication
+///@{
+
+///@name Kratos Globals
+///@{
+
+///@}
+///@name Type Definitions
+///@{
+
+///@}
+///@name  Enum's
+///@{
+
+///@}
+///@name  Functions
+///@{
+
+///@}
+///@name Kratos Classes
+///@{
+
+/// Short class definition.
+/** Base class for the level sets combining an arbitrary number of level sets, e.g. n-ary union or intersection.
+ * The operands providing a bounding box are stored in a bounding volume hierarchy, hence the derived classes can
+ * only evaluate the operands whose bounding box is relevant to the query point. The operands without bounding box
+ * are always evaluated. The derived classes select the operand giving the value at a point, the gradient and
+ * the Hessian are the ones of that operand.
+ * The hierarchy is built when the operands are given; Initialize shall be called if an operand is modified later.
+ * The value is not continuous at the bounding boxes away from the zero level, hence no Lipschitz constant is provided.
+ */
+class NaryLevelSet : public LevelSet
+{
+public:
+    ///@name Type Definitions
+    ///@{
+
+    /// Pointer definition of NaryLevelSet
+    KRATOS_CLASS_POINTER_DEFINITION(NaryLevelSet);
+
+    typedef LevelSet BaseType;
+
+    /// Maximum number of operands in a leaf of the hierarchy
+    static const std::size_t LEAF_SIZE = 2;
+
+    /// Returned index if no operand is found
+    static const std::size_t NONE = static_cast<std::size_t>(-1);
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// Default constructor.
+    NaryLevelSet(const std::vector<LevelSet::Pointer>& pLevelSets)
+    : BaseType(), mpLevelSets(pLevelSets)
+    {
+        this->Initialize();
+    }
+
+    /// Default constructor, only used by the serializer.
+    NaryLevelSet() : BaseType()
+    {}
+
+    /// Copy constructor.
+    NaryLevelSet(NaryLevelSet const& rOther)
+    : BaseType(rOther), mpLevelSets(rOther.mpLevelSets.size())
+    , mMin(rOther.mMin), mMax(rOther.mMax), mUnbounded(rOther.mUnbounded)
+    , mNodes(rOther.mNodes), mOrder(rOther.mOrder)
+    {
+        for(std::size_t i = 0; i < mpLevelSets.size(); ++i)
+            mpLevelSets[i] = rOther.mpLevelSets[i]->CloneLevelSet();
+    }
+
+    /// Destructor.
+    virtual ~NaryLevelSet() {}
+
+
+    ///@}
+    ///@name Operators
+    ///@{
+
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+
+    /// Add an operand and rebuild the hierarchy
+    void AddLevelSet(const LevelSet::Pointer pLevelSet)
+    {
+        mpLevelSets.push_back(pLevelSet);
+        this->Initialize();
+    }
+
+
+    /// Collect the bounding boxes of the operands and build the hierarchy over them
+    void Initialize()
+    {
+        const std::size_t n = mpLevelSets.size();
+        mMin.resize(n);
+        mMax.resize(n);
+        mUnbounded.clear();
+        mOrder.clear();
+
+        std::vector<array_1d<double, 3> > Centroids(n);
+        PointType Min, Max;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            if(!mpLevelSets[i]->GetBoundingBox(Min, Max))
+            {
+                for(std::size_t d = 0; d < 3; ++d)
+                {
+                    mMin[i][d] = -std::numeric_limits<double>::infinity();
+                    mMax[i][d] = std::numeric_limits<double>::infinity();
+                }
+                mUnbounded.push_back(i);
+                continue;
+            }
+
+            for(std::size_t d = 0; d < 3; ++d)
+            {
+                mMin[i][d] = Min[d];
+                mMax[i][d] = Max[d];
+
+                // the extent may be infinite in some directions
+                const bool is_finite_min = (Min[d] > -std::numeric_limits<double>::max());
+                const bool is_finite_max = (Max[d] < std::numeric_limits<double>::max());
+                if(is_finite_min && is_finite_max)
+                    Centroids[i][d] = 0.5*(Min[d] + Max[d]);
+                else if(is_finite_min)
+                    Centroids[i][d] = Min[d];
+                else if(is_finite_max)
+                    Centroids[i][d] = Max[d];
+                else
+                    Centroids[i][d] = 0.0;
+            }
+
+            mOrder.push_back(i);
+        }
+
+        mNodes.clear();
+        if(mOrder.size() == 0)
+            return;
+
+        mNodes.resize(2*mOrder.size() - 1);
+        this->BuildNode(0, 0, mOrder.size(), Centroids);
+    }
+
+
+    std::size_t NumberOfLevelSets() const
+    {
+        return mpLevelSets.size();
+    }
+
+
+    LevelSet::Pointer pGetLevelSet(const std::size_t i) const
+    {
+        return mpLevelSets[i];
+    }
+
+
+    virtual std::size_t WorkingSpaceDimension() const
+    {
+        this->CheckNotEmpty();
+        return mpLevelSets[0]->WorkingSpaceDimension();
+    }
+
+
+    virtual double GetValue(const PointType& P) const
+    {
+        double value;
+        this->FindActiveLevelSet(P, value);
+        return value;
+    }
+
+
+    virtual void GetGradient(const PointType& P, array_1d<double, 3>& rGradient) const
+    {
+        double value;
+        const std::size_t i = this->FindActiveLevelSet(P, value);
+        mpLevelSets[i]->GetGradient(P, rGradient);
+    }
+
+
+    virtual void GetGradientDerivatives(const PointType& P, bounded_matrix<double, 3, 3>& rDerivatives) const
+    {
+        double value;
+        const std::size_t i = this->FindActiveLevelSet(P, value);
+        mpLevelSets[i]->GetGradientDerivatives(P, rDerivatives);
+    }
+
+
+    virtual void GetValueGradientHessian(const PointType& P, double& rValue, array_1d<double, 3>& rGradient,
+            bounded_matrix<double, 3, 3>& rHessian) const
+    {
+        const std::size_t i = this->FindActiveLevelSet(P, rValue);
+        mpLevelSets[i]->GetValueGradientHessian(P, rValue, rGradient, rHessian);
+    }
+
+
+    ///@}
+    ///@name Access
+    ///@{
+
+
+    ///@}
+    ///@name Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Input and output
+    ///@{
+
+    /// Turn back information as a string.
+    virtual std::string Info() const
+    {
+        return "N-ary Level Set";
+    }
+
+    /// Print information about this object.
+    virtual void PrintInfo(std::ostream& rOStream) const
+    {
+        rOStream << Info();
+    }
+
+    /// Print object's data.
+    virtual void PrintData(std::ostream& rOStream) const
+    {
+        rOStream << "Number of level sets: " << mpLevelSets.size()
+                 << ", without bounding box: " << mUnbounded.size();
+    }
+
+
+    ///@}
+    ///@name Friends
+    ///@{
+
+
+    ///@}
+
+protected:
+    ///@name Protected static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Protected member Variables
+    ///@{
+
+
+    std::vector<LevelSet::Pointer> mpLevelSets;
+    std::vector<array_1d<double, 3> > mMin, mMax; // bounding box of each operand, infinite if it has none
+    std::vector<std::size_t> mUnbounded; // operands without bounding box
+
+
+    ///@}
+    ///@name Protected Operators
+    ///@{
+
+
+    ///@}
+    ///@name Protected Operations
+    ///@{
+
+
+    /// Find the operand giving the value at a point and compute the value
+    virtual std::size_t FindActiveLevelSet(const PointType& P, double& rValue) const
+    {
+        KRATOS_THROW_ERROR(std::logic_error, "Calling the base class", __FUNCTION__)
+    }
+
+
+    void CheckNotEmpty() const
+    {
+        if(mpLevelSets.size() == 0)
+            KRATOS_THROW_ERROR(std::logic_error, "The n-ary level set has no operand", "")
+    }
+
+
+    /// Call rVisitor(i) for each operand i whose bounding box contains P
+    template<class TVisitorType>
+    void VisitContaining(const PointType& P, TVisitorType& rVisitor) const
+    {
+        if(mNodes.size() == 0)
+            return;
+
+        std::size_t stack[128];
+        std::size_t top = 0;
+        stack[top++] = 0;
+        while(top > 0)
+        {
+            const std::size_t index = stack[--top];
+            const BVHNode& rNode = mNodes[index];
+            if(!IsInBox(P, rNode.Min, rNode.Max))
+                continue;
+
+            if(rNode.IsLeaf)
+            {
+                for(std::size_t k = rNode.Begin; k < rNode.End; ++k)
+                    if(IsInBox(P, mMin[mOrder[k]], mMax[mOrder[k]]))
+                        rVisitor(mOrder[k]);
+            }
+            else
+            {
+                stack[top++] = rNode.Right;
+                stack[top++] = index + 1;
+            }
+        }
+    }
+
+
+    /// Call rVisitor(i) for each operand i whose bounding box overlaps the box [rMin, rMax]
+    template<class TVisitorType>
+    void VisitOverlapping(const PointType& rMin, const PointType& rMax, TVisitorType& rVisitor) const
+    {
+        if(mNodes.size() == 0)
+            return;
+
+        std::size_t stack[128];
+        std::size_t top = 0;
+        stack[top++] = 0;
+        while(top > 0)
+        {
+            const std::size_t index = stack[--top];
+            const BVHNode& rNode = mNodes[index];
+            if(!IsOverlapping(rMin, rMax, rNode.Min, rNode.Max))
+                continue;
+
+            if(rNode.IsLeaf)
+            {
+                for(std::size_t k = rNode.Begin; k < rNode.End; ++k)
+                    if(IsOverlapping(rMin, rMax, mMin[mOrder[k]], mMax[mOrder[k]]))
+                        rVisitor(mOrder[k]);
+            }
+            else
+            {
+                stack[top++] = rNode.Right;
+                stack[top++] = index + 1;
+            }
+        }
+    }
+
+
+    /// Find the operand with the bounding box nearest to P
+    std::size_t FindNearest(const PointType& P) const
+    {
+        std::size_t nearest = NONE;
+        double best = std::numeric_limits<double>::max();
+
+        std::size_t stack[128];
+        std::size_t top = 0;
+        if(mNodes.size() != 0)
+            stack[top++] = 0;
+        while(top > 0)
+        {
+            const std::size_t index = stack[--top];
+            const BVHNode& rNode = mNodes[index];
+            if(BoxDistance2(P, rNode.Min, rNode.Max) >= best)
+                continue;
+
+            if(rNode.IsLeaf)
+            {
+                for(std::size_t k = rNode.Begin; k < rNode.End; ++k)
+                {
+                    const double d2 = BoxDistance2(P, mMin[mOrder[k]], mMax[mOrder[k]]);
+                    if(d2 < best)
+                    {
+                        best = d2;
+                        nearest = mOrder[k];
+                    }
+                }
+            }
+            else
+            {
+                // visit the nearer child first
+                const std::size_t left = index + 1;
+                const std::size_t right = rNode.Right;
+                if(BoxDistance2(P, mNodes[left].Min, mNodes[left].Max) < BoxDistance2(P, mNodes[right].Min, mNodes[right].Max))
+                {
+                    stack[top++] = right;
+                    stack[top++] = left;
+                }
+                else
+                {
+                    stack[top++] = left;
+                    stack[top++] = right;
+                }
+            }
+        }
+
+        return nearest;
+    }
+
+
+    /// Find an operand whose bounding box does not contain P
+    std::size_t FindExcluding(const PointType& P) const
+    {
+        std::size_t stack[128];
+        std::size_t top = 0;
+        if(mNodes.size() != 0)
+            stack[top++] = 0;
+        while(top > 0)
+        {
+            const std::size_t index = stack[--top];
+            const BVHNode& rNode = mNodes[index];
+
+            // all the operands of a node which does not contain P exclude it
+            if(!IsInBox(P, rNode.Min, rNode.Max))
+                return mOrder[rNode.Begin];
+
+            if(rNode.IsLeaf)
+            {
+                for(std::size_t k = rNode.Begin; k < rNode.End; ++k)
+                    if(!IsInBox(P, mMin[mOrder[k]], mMax[mOrder[k]]))
+                        return mOrder[k];
+            }
+            else
+            {
+                stack[top++] = rNode.Right;
+                stack[top++] = index + 1;
+            }
+        }
+
+        return NONE;
+    }
+
+
+    /// Find an operand whose bounding box is disjoint from the box [rMin, rMax]
+    std::size_t FindDisjoint(const PointType& rMin, const PointType& rMax) const
+    {
+        std::size_t stack[128];
+        std::size_t top = 0;
+        if(mNodes.size() != 0)
+            stack[top++] = 0;
+        while(top > 0)
+        {
+            const std::size_t index = stack[--top];
+            const BVHNode& rNode = mNodes[index];
+
+            if(!IsOverlapping(rMin, rMax, rNode.Min, rNode.Max))
+                return mOrder[rNode.Begin];
+
+            if(rNode.IsLeaf)
+            {
+                for(std::size_t k = rNode.Begin; k < rNode.End; ++k)
+                    if(!IsOverlapping(rMin, rMax, mMin[mOrder[k]], mMax[mOrder[k]]))
+                        return mOrder[k];
+            }
+            else
+            {
+                stack[top++] = rNode.Right;
+                stack[top++] = index + 1;
+            }
+        }
+
+        return NONE;
+    }
+
+
+    /// Get the bounding box of all the operands, if all of them have one
+    bool GetMergedBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        if(mNodes.size() == 0 || mUnbounded.size() != 0)
+            return false;
+
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            rMin[d] = mNodes[0].Min[d];
+            rMax[d] = mNodes[0].Max[d];
+        }
+        return true;
+    }
+
+
+    ///@}
+    ///@name Protected  Access
+    ///@{
+
+
+    ///@}
+    ///@name Protected Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Protected LifeCycle
+    ///@{
+
+
+    ///@}
+
+private:
+    ///@name Static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Member Variables
+    ///@{
+
+
+    /// Node of the bounding volume hierarchy. The left child of an inner node follows it in mNodes, the right child
+    /// is at Right. A leaf holds the operands mOrder[Begin], ..., mOrder[End-1].
+    struct BVHNode
+    {
+        array_1d<double, 3> Min;
+        array_1d<double, 3> Max;
+        std::size_t Begin;
+        std::size_t End;
+        std::size_t Right;
+        bool IsLeaf;
+    };
+
+
+    std::vector<BVHNode> mNodes;
+    std::vector<std::size_t> mOrder; // operands with bounding box, in the order of the leaves
+
+
+    ///@}
+    ///@name Private Operators
+    ///@{
+
+
+    ///@}
+    ///@name Private Operations
+    ///@{
+
+
+    /// Build the subtree of the operands mOrder[begin:end] at node by median split along the largest extent of
+    /// the centroids. A subtree of m operands occupies 2m-1 consecutive nodes.
+    void BuildNode(const std::size_t node, const std::size_t begin, const std::size_t end,
+        const std::vector<array_1d<double, 3> >& rCentroids)
+    {
+        BVHNode& rNode = mNodes[node];
+        rNode.Begin = begin;
+        rNode.End = end;
+
+        array_1d<double, 3> CMin, CMax;
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            rNode.Min[d] = std::numeric_limits<double>::infinity();
+            rNode.Max[d] = -std::numeric_limits<double>::infinity();
+            CMin[d] = std::numeric_limits<double>::max();
+            CMax[d] = -std::numeric_limits<double>::max();
+        }
+
+        for(std::size_t k = begin; k < end; ++k)
+        {
+            const std::size_t i = mOrder[k];
+            for(std::size_t d = 0; d < 3; ++d)
+            {
+                rNode.Min[d] = std::min(rNode.Min[d], mMin[i][d]);
+                rNode.Max[d] = std::max(rNode.Max[d], mMax[i][d]);
+                CMin[d] = std::min(CMin[d], rCentroids[i][d]);
+                CMax[d] = std::max(CMax[d], rCentroids[i][d]);
+            }
+        }
+
+        if(end - begin <= LEAF_SIZE)
+        {
+            rNode.IsLeaf = true;
+            rNode.Right = 0;
+            return;
+        }
+
+        std::size_t axis = 0;
+        for(std::size_t d = 1; d < 3; ++d)
+            if(CMax[d] - CMin[d] > CMax[axis] - CMin[axis])
+                axis = d;
+
+        const std::size_t mid = begin + (end - begin) / 2;
+        std::nth_element(mOrder.begin() + begin, mOrder.begin() + mid, mOrder.begin() + end,
+            CentroidLess(rCentroids, axis));
+
+        rNode.IsLeaf = false;
+        rNode.Right = node + 2*(mid - begin);
+
+        const std::size_t right = rNode.Right;
+        this->BuildNode(node + 1, begin, mid, rCentroids);
+        this->BuildNode(right, mid, end, rCentroids);
+    }
+
+
+    static bool IsInBox(const PointType& P, const array_1d<double, 3>& rMin, const array_1d<double, 3>& rMax)
+    {
+        return (P[0] >= rMin[0] && P[0] <= rMax[0])
+            && (P[1] >= rMin[1] && P[1] <= rMax[1])
+            && (P[2] >= rMin[2] && P[2] <= rMax[2]);
+    }
+
+
+    static bool IsOverlapping(const PointType& rMin1, const PointType& rMax1,
+        const array_1d<double, 3>& rMin2, const array_1d<double, 3>& rMax2)
+    {
+        for(std::size_t d = 0; d < 3; ++d)
+            if(rMax1[d] < rMin2[d] || rMin1[d] > rMax2[d])
+                return false;
+        return true;
+    }
+
+
+    /// Squared distance from a point to a box
+    static double BoxDistance2(const PointType& P, const array_1d<double, 3>& rMin, const array_1d<double, 3>& rMax)
+    {
+        double d2 = 0.0;
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            if(P[d] < rMin[d])
+                d2 += (rMin[d] - P[d]) * (rMin[d] - P[d]);
+            else if(P[d] > rMax[d])
+                d2 += (P[d] - rMax[d]) * (P[d] - rMax[d]);
+        }
+        return d2;
+    }
+
+
+    /// Order of the operands by a coordinate of the centroid of the bounding box
+    struct CentroidLess
+    {
+        CentroidLess(const std::vector<array_1d<double, 3> >& rCentroids, const std::size_t axis) : mrCentroids(rCentroids), mAxis(axis) {}
+        bool operator()(const std::size_t i, const std::size_t j) const
+        {
+            return mrCentroids[i][mAxis] < mrCentroids[j][mAxis];
+        }
+        const std::vector<array_1d<double, 3> >& mrCentroids;
+        std::size_t mAxis;
+    };
+
+
+    friend class Serializer;
+
+    /// Only the operands are saved, the hierarchy is rebuilt on loading
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("LevelSets", mpLevelSets);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("LevelSets", mpLevelSets);
+        this->Initialize();
+    }
+
+    ///@}
+    ///@name Private  Access
+    ///@{
+
+
+    ///@}
+    ///@name Private Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Un accessible methods
+    ///@{
+
+    /// Assignment operator.
+    NaryLevelSet& operator=(NaryLevelSet const& rOther);
+
+    ///@}
+
+}; // Class NaryLevelSet
+
+///@}
+
+///@name Type Definitions
+///@{
+
+
+///@}
+///@name Input and output
+///@{
+
+
+/// input stream function
+inline std::istream& operator >> (std::istream& rIStream, NaryLevelSet& rThis)
+{
+    return rIStream;
+}
+
+/// output stream function
+inline std::ostream& operator << (std::ostream& rOStream, const NaryLevelSet& rThis)
+{
+    rThis.PrintInfo(rOStream);
+    rOStream << std::endl;
+    rThis.PrintData(rOStream);
+
+    return rOStream;
+}
+///@}
+
+///@} addtogroup block
+
+}  // namespace Kratos.
+
+#endif // KRATOS_NARY_LEVEL_SET_H_INCLUDED  defined
@@ -0,0 +1,362 @@
+//    |  /           |
+//    ' /   __| _` | __|  _ \   __|
+//    . \  |   (   | |   (   |\__ `
+//   _|\_\_|  \__,_|\__|\___/ ____/
+//                   Multi-Physics
+//
+//  License:         brep_application/LICENSE.txt
+//                   Kratos default license: kratos/license.txt
+//
+//  Main authors:    Hoang-Giang Bui
+//  Date:            16 Oct 2026
+//
+
+
+#if !defined(KRATOS_NARY_UNION_LEVEL_SET_H_INCLUDED )
+#define  KRATOS_NARY_UNION_LEVEL_SET_H_INCLUDED
+
+
+
+// System includes
+#include <string>
+#include <limits>
+#include <iostream>
+
+
+// External includes
+
+
+// Project includes
+#include "includes/define.h"
+#include "custom_algebra/level_set/nary_level_set.h"
+
+
+namespace Kratos
+{
+///@addtogroup BRepApplication
+///@{
+
+///@name Kratos Globals
+///@{
+
+///@}
+///@name Type Definitions
+///@{
+
+///@}
+///@name  Enum's
+///@{
+
+///@}
+///@name  Functions
+///@{
+
+///@}
+///@name Kratos Classes
+///@{
+
+/// Short class definition.
+/** Class for union of an arbitrary number of level sets, i.e. the minimum of the operands. Only the operands whose
+ * bounding box contains the query point are evaluated. Hence the value is exact inside of the union and near its
+ * boundary, while far outside of it, it is the value of the operand with the nearest bounding box, which is
+ * positive but may be larger than the minimum.
+*/
+class NaryUnionLevelSet : public NaryLevelSet
+{
+public:
+    ///@name Type Definitions
+    ///@{
+
+    /// Pointer definition of NaryUnionLevelSet
+    KRATOS_CLASS_POINTER_DEFINITION(NaryUnionLevelSet);
+
+    typedef NaryLevelSet BaseType;
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// Default constructor.
+    NaryUnionLevelSet(const std::vector<LevelSet::Pointer>& pLevelSets)
+    : BaseType(pLevelSets)
+    {}
+
+    /// Default constructor, also used by the serializer. The operands are added by AddLevelSet.
+    NaryUnionLevelSet() : BaseType()
+    {}
+
+    /// Copy constructor.
+    NaryUnionLevelSet(NaryUnionLevelSet const& rOther)
+    : BaseType(rOther)
+    {}
+
+    /// Destructor.
+    virtual ~NaryUnionLevelSet() {}
+
+
+    ///@}
+    ///@name Operators
+    ///@{
+
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+
+    virtual LevelSet::Pointer CloneLevelSet() const
+    {
+        return LevelSet::Pointer(new NaryUnionLevelSet(*this));
+    }
+
+
+    /// The union is bounded only if all the operands are bounded
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        return this->GetMergedBoundingBox(rMin, rMax);
+    }
+
+
+    /// The operands disjoint from the box are outside, hence only the overlapping ones are checked
+    virtual int CutStatusOfBox(const PointType& rMin, const PointType& rMax) const
+    {
+        BoxStatusVisitor Visitor(mpLevelSets, rMin, rMax);
+        this->VisitOverlapping(rMin, rMax, Visitor);
+        for(std::size_t k = 0; k < mUnbounded.size(); ++k)
+            Visitor(mUnbounded[k]);
+
+        if(Visitor.IsIn)
+            return BRep::_IN;
+        if(Visitor.IsCut)
+            return BRep::_CUT;
+        return BRep::_OUT;
+    }
+
+
+    ///@}
+    ///@name Access
+    ///@{
+
+
+    ///@}
+    ///@name Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Input and output
+    ///@{
+
+    /// Turn back information as a string.
+    virtual std::string Info() const
+    {
+        return "N-ary Union Level Set";
+    }
+
+    /// Print information about this object.
+    virtual void PrintInfo(std::ostream& rOStream) const
+    {
+        rOStream << Info();
+    }
+
+    /// Print object's data.
+    virtual void PrintData(std::ostream& rOStream) const
+    {
+        BaseType::PrintData(rOStream);
+    }
+
+
+    ///@}
+    ///@name Friends
+    ///@{
+
+
+    ///@}
+
+protected:
+    ///@name Protected static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Protected member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Protected Operators
+    ///@{
+
+
+    ///@}
+    ///@name Protected Operations
+    ///@{
+
+
+    /// The point is inside of the union only if it is inside of an operand, i.e. within its bounding box, hence
+    /// only the operands whose bounding box contains the point are evaluated. If there is none, the point is outside
+    /// and the value of the operand with the nearest bounding box is taken.
+    virtual std::size_t FindActiveLevelSet(const PointType& P, double& rValue) const
+    {
+        this->CheckNotEmpty();
+
+        MinimumVisitor Visitor(mpLevelSets, P);
+        this->VisitContaining(P, Visitor);
+        for(std::size_t k = 0; k < mUnbounded.size(); ++k)
+            Visitor(mUnbounded[k]);
+
+        if(Visitor.Index == NONE)
+            Visitor(this->FindNearest(P));
+
+        rValue = Visitor.Value;
+        return Visitor.Index;
+    }
+
+
+    ///@}
+    ///@name Protected  Access
+    ///@{
+
+
+    ///@}
+    ///@name Protected Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Protected LifeCycle
+    ///@{
+
+
+    ///@}
+
+private:
+    ///@name Static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Private Operators
+    ///@{
+
+
+    ///@}
+    ///@name Private Operations
+    ///@{
+
+
+    /// Keep the minimum value of the visited operands
+    struct MinimumVisitor
+    {
+        MinimumVisitor(const std::vector<LevelSet::Pointer>& rpLevelSets, const PointType& rP)
+        : mrpLevelSets(rpLevelSets), mrP(rP), Value(std::numeric_limits<double>::max()), Index(NONE) {}
+        void operator()(const std::size_t i)
+        {
+            const double v = mrpLevelSets[i]->GetValue(mrP);
+            if(Index == NONE || v < Value)
+            {
+                Value = v;
+                Index = i;
+            }
+        }
+        const std::vector<LevelSet::Pointer>& mrpLevelSets;
+        const PointType& mrP;
+        double Value;
+        std::size_t Index;
+    };
+
+
+    /// Combine the status of the visited operands w.r.t a box
+    struct BoxStatusVisitor
+    {
+        BoxStatusVisitor(const std::vector<LevelSet::Pointer>& rpLevelSets, const PointType& rMin, const PointType& rMax)
+        : mrpLevelSets(rpLevelSets), mrMin(rMin), mrMax(rMax), IsIn(false), IsCut(false) {}
+        void operator()(const std::size_t i)
+        {
+            if(IsIn)
+                return;
+            const int stat = mrpLevelSets[i]->CutStatusOfBox(mrMin, mrMax);
+            if(stat == BRep::_IN)
+                IsIn = true;
+            else if(stat == BRep::_CUT)
+                IsCut = true;
+        }
+        const std::vector<LevelSet::Pointer>& mrpLevelSets;
+        const PointType& mrMin;
+        const PointType& mrMax;
+        bool IsIn;
+        bool IsCut;
+    };
+
+
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+    }
+
+    ///@}
+    ///@name Private  Access
+    ///@{
+
+
+    ///@}
+    ///@name Private Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Un accessible methods
+    ///@{
+
+    /// Assignment operator.
+    NaryUnionLevelSet& operator=(NaryUnionLevelSet const& rOther);
+
+    ///@}
+
+}; // Class NaryUnionLevelSet
+
+///@}
+
+///@name Type Definitions
+///@{
+
+
+///@}
+///@name Input and output
+///@{
+
+
+/// input stream function
+inline std::istream& operator >> (std::istream& rIStream, NaryUnionLevelSet& rThis)
+{
+    return rIStream;
+}
+
+/// output stream function
+inline std::ostream& operator << (std::ostream& rOStream, const NaryUnionLevelSet& rThis)
+{
+    rThis.PrintInfo(rOStream);
+    rOStream << std::endl;
+    rThis.PrintData(rOStream);
+
+    return rOStream;
+}
+///@}
+
+///@} addtogroup block
+
+}  // namespace Kratos.
+
+#endif // KRATOS_NARY_UNION_LEVEL_SET_H_INCLUDED  defined
@@ -77,6 +77,10 @@ public:
     : BaseType(), mA(A), mB(B), mC(C), mD(D)
     {}
 
+    /// Default constructor, only used by the serializer.
+    PlanarLevelSet() : BaseType(), mA(0.0), mB(0.0), mC(0.0), mD(0.0)
+    {}
+
     /// Copy constructor.
     PlanarLevelSet(PlanarLevelSet const& rOther)
     : BaseType(rOther), mA(rOther.mA), mB(rOther.mB), mC(rOther.mC), mD(rOther.mD)
@@ -108,27 +112,85 @@ public:
     }
 
 
+    /// The half space is bounded in one direction only if the plane is normal to an axis
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        const double c[] = {mA, mB, mC};
+        int axis = -1;
+        for(int d = 0; d < 3; ++d)
+        {
+            if(c[d] != 0.0)
+            {
+                if(axis != -1)
+                    return false;
+                axis = d;
+            }
+        }
+
+        if(axis == -1)
+            return false;
+
+        for(int d = 0; d < 3; ++d)
+        {
+            rMin[d] = -std::numeric_limits<double>::infinity();
+            rMax[d] = std::numeric_limits<double>::infinity();
+        }
+
+        if(c[axis] > 0.0)
+            rMax[axis] = -mD / c[axis];
+        else
+            rMin[axis] = -mD / c[axis];
+
+        return true;
+    }
+
+
     virtual double GetValue(const PointType& P) const
     {
         return mA*P(0) + mB*P(1) + mC*P(2) + mD;
     }
 
 
-    virtual Vector GetGradient(const PointType& P) const
+    virtual void GetValues(const PointType* P, const std::size_t n, double* Values) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = mA*P[i][0] + mB*P[i][1] + mC*P[i][2] + mD;
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        typedef FunctionTape<InputType, OutputType> TapeType;
+        std::size_t v = rTape.AddBinary(TapeType::ADD, rTape.AddUnary(TapeType::SCALE, rTape.AddVariable(0), mA), rTape.AddUnary(TapeType::SCALE, rTape.AddVariable(1), mB));
+        v = rTape.AddBinary(TapeType::ADD, v, rTape.AddUnary(TapeType::SCALE, rTape.AddVariable(2), mC));
+        return rTape.AddBinary(TapeType::ADD, v, rTape.AddConstant(mD));
+    }
+
+
+    virtual void GetGradient(const PointType& P, array_1d<double, 3>& rGradient) const
+    {
+        rGradient[0] = mA;
+        rGradient[1] = mB;
+        rGradient[2] = mC;
+    }
+
+
+    virtual void GetGradientDerivatives(const PointType& P, bounded_matrix<double, 3, 3>& rDerivatives) const
     {
-        Vector grad(this->WorkingSpaceDimension());
-        grad(0) = mA;
-        grad(1) = mB;
-        grad(2) = mC;
-        return grad;
+        noalias(rDerivatives) = ZeroMatrix(3, 3);
     }
 
 
-    virtual Matrix GetGradientDerivatives(const PointType& P) const
+    virtual void GetValueGradientHessian(const PointType& P, double& rValue, array_1d<double, 3>& rGradient,
+            bounded_matrix<double, 3, 3>& rHessian) const
     {
-        Matrix Jac(this->WorkingSpaceDimension(), 3);
-        noalias(Jac) = ZeroMatrix(this->WorkingSpaceDimension(), 3);
-        return Jac;
+        rValue = mA*P(0) + mB*P(1) + mC*P(2) + mD;
+
+        rGradient[0] = mA;
+        rGradient[1] = mB;
+        rGradient[2] = mC;
+
+        noalias(rHessian) = ZeroMatrix(3, 3);
     }
 
 
@@ -224,6 +286,12 @@ protected:
     ///@{
 
 
+    virtual double ComputeLipschitzConstant(const PointType& rMin, const PointType& rMax) const
+    {
+        return std::sqrt(mA*mA + mB*mB + mC*mC);
+    }
+
+
     ///@}
     ///@name Protected  Access
     ///@{
@@ -263,6 +331,25 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("A", mA);
+        rSerializer.save("B", mB);
+        rSerializer.save("C", mC);
+        rSerializer.save("D", mD);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("A", mA);
+        rSerializer.load("B", mB);
+        rSerializer.load("C", mC);
+        rSerializer.load("D", mD);
+    }
 
     ///@}
     ///@name Private  Access
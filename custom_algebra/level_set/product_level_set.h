@@ -87,6 +87,10 @@ public:
     : BaseType(), mp_level_set_1(p_level_set_1), mp_level_set_2(p_level_set_2)
     {}
 
+    /// Default constructor, only used by the serializer.
+    ProductLevelSet() : BaseType()
+    {}
+
     /// Copy constructor.
     ProductLevelSet(ProductLevelSet const& rOther)
     : BaseType(rOther)
@@ -120,28 +124,87 @@ public:
     }
 
 
+    /// The product is negative only inside of one of the level sets, hence it is bounded if both level sets are bounded
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        PointType Min2, Max2;
+        if(!mp_level_set_1->GetBoundingBox(rMin, rMax) || !mp_level_set_2->GetBoundingBox(Min2, Max2))
+            return false;
+
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            rMin[d] = std::min(rMin[d], Min2[d]);
+            rMax[d] = std::max(rMax[d], Max2[d]);
+        }
+        return true;
+    }
+
+
+    virtual int CutStatusOfBox(const PointType& rMin, const PointType& rMax) const
+    {
+        const int stat_1 = mp_level_set_1->CutStatusOfBox(rMin, rMax);
+        if(stat_1 == BRep::_CUT)
+            return BRep::_CUT;
+
+        const int stat_2 = mp_level_set_2->CutStatusOfBox(rMin, rMax);
+        if(stat_2 == BRep::_CUT)
+            return BRep::_CUT;
+
+        return (stat_1 == stat_2) ? BRep::_OUT : BRep::_IN;
+    }
+
+
     virtual double GetValue(const PointType& P) const
     {
         return mp_level_set_1->GetValue(P) * mp_level_set_2->GetValue(P);
     }
 
 
-    virtual Vector GetGradient(const PointType& P) const
+    virtual void GetValues(const PointType* P, const std::size_t n, double* Values) const
+    {
+        std::vector<double> Values2(n);
+        mp_level_set_1->GetValues(P, n, Values);
+        mp_level_set_2->GetValues(P, n, &Values2[0]);
+        for(std::size_t i = 0; i < n; ++i)
+            Values[i] = Values[i] * Values2[i];
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        typedef FunctionTape<InputType, OutputType> TapeType;
+        return rTape.AddBinary(TapeType::MULTIPLY, mp_level_set_1->Compile(rTape), mp_level_set_2->Compile(rTape));
+    }
+
+
+    virtual void GetGradient(const PointType& P, array_1d<double, 3>& rGradient) const
     {
         double phi_1 = mp_level_set_1->GetValue(P);
         double phi_2 = mp_level_set_2->GetValue(P);
 
-        Vector grad_1 = mp_level_set_1->GetGradient(P);
-        Vector grad_2 = mp_level_set_2->GetGradient(P);
-
-        const std::size_t dim = WorkingSpaceDimension();
+        array_1d<double, 3> grad_1, grad_2;
+        mp_level_set_1->GetGradient(P, grad_1);
+        mp_level_set_2->GetGradient(P, grad_2);
 
-        Vector result(dim);
+        noalias(rGradient) = phi_2 * grad_1 + phi_1 * grad_2;
+    }
 
-        for(std::size_t i = 0; i < dim; ++i)
-            result(i) = grad_1(i) * phi_2 + phi_1 * grad_2(i);
 
-        return result;
+    /// The Hessian of the product is H_1 phi_2 + grad_1 grad_2^T + grad_2 grad_1^T + phi_1 H_2
+    virtual void GetValueGradientHessian(const PointType& P, double& rValue, array_1d<double, 3>& rGradient,
+            bounded_matrix<double, 3, 3>& rHessian) const
+    {
+        double phi_1, phi_2;
+        array_1d<double, 3> grad_1, grad_2;
+        bounded_matrix<double, 3, 3> hess_1, hess_2;
+        mp_level_set_1->GetValueGradientHessian(P, phi_1, grad_1, hess_1);
+        mp_level_set_2->GetValueGradientHessian(P, phi_2, grad_2, hess_2);
+
+        rValue = phi_1 * phi_2;
+        noalias(rGradient) = phi_2 * grad_1 + phi_1 * grad_2;
+        for (std::size_t i = 0; i < 3; ++i)
+            for (std::size_t j = 0; j < 3; ++j)
+                rHessian(i, j) = phi_2 * hess_1(i, j) + grad_1[i] * grad_2[j] + grad_2[i] * grad_1[j] + phi_1 * hess_2(i, j);
     }
 
 
@@ -195,8 +258,8 @@ protected:
     ///@{
 
 
-    const BaseType::Pointer mp_level_set_1;
-    const BaseType::Pointer mp_level_set_2;
+    BaseType::Pointer mp_level_set_1;
+    BaseType::Pointer mp_level_set_2;
 
 
     ///@}
@@ -209,6 +272,30 @@ protected:
     ///@{
 
 
+    /// |grad(phi_1 phi_2)| <= |phi_1| L_2 + |phi_2| L_1, where |phi_i| is bounded within the box by its value at the
+    /// center and L_i
+    virtual double ComputeLipschitzConstant(const PointType& rMin, const PointType& rMax) const
+    {
+        const double L1 = mp_level_set_1->GetLipschitzConstant(rMin, rMax);
+        const double L2 = mp_level_set_2->GetLipschitzConstant(rMin, rMax);
+        if(!(L1 < std::numeric_limits<double>::infinity()) || !(L2 < std::numeric_limits<double>::infinity()))
+            return std::numeric_limits<double>::infinity();
+
+        PointType Center;
+        double radius = 0.0;
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            Center[d] = 0.5*(rMin[d] + rMax[d]);
+            radius += 0.25*(rMax[d] - rMin[d])*(rMax[d] - rMin[d]);
+        }
+        radius = std::sqrt(radius);
+
+        const double phi_1 = std::fabs(mp_level_set_1->GetValue(Center)) + L1*radius;
+        const double phi_2 = std::fabs(mp_level_set_2->GetValue(Center)) + L2*radius;
+        return phi_1*L2 + phi_2*L1;
+    }
+
+
     ///@}
     ///@name Protected  Access
     ///@{
@@ -245,6 +332,21 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("LevelSet1", mp_level_set_1);
+        rSerializer.save("LevelSet2", mp_level_set_2);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("LevelSet1", mp_level_set_1);
+        rSerializer.load("LevelSet2", mp_level_set_2);
+    }
 
     ///@}
     ///@name Private  Access
@@ -77,6 +77,10 @@ public:
     : BaseType(), mcX(cX), mcY(cY), mcZ(cZ), mR(R)
     {}
 
+    /// Default constructor, only used by the serializer.
+    SphericalLevelSet() : BaseType(), mcX(0.0), mcY(0.0), mcZ(0.0), mR(0.0)
+    {}
+
     /// Copy constructor.
     SphericalLevelSet(SphericalLevelSet const& rOther)
     : BaseType(rOther), mcX(rOther.mcX), mcY(rOther.mcY), mcZ(rOther.mcZ), mR(rOther.mR)
@@ -108,19 +112,72 @@ public:
     }
 
 
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        const double R = std::fabs(mR);
+        rMin[0] = mcX - R; rMax[0] = mcX + R;
+        rMin[1] = mcY - R; rMax[1] = mcY + R;
+        rMin[2] = mcZ - R; rMax[2] = mcZ + R;
+        return true;
+    }
+
+
     virtual double GetValue(const PointType& P) const
     {
         return pow(P(0) - mcX, 2) + pow(P(1) - mcY, 2) + pow(P(2) - mcZ, 2) - pow(mR, 2);
     }
 
 
-    virtual Vector GetGradient(const PointType& P) const
+    virtual void GetValues(const PointType* P, const std::size_t n, double* Values) const
+    {
+        const double R2 = mR*mR;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            const double dx = P[i][0] - mcX;
+            const double dy = P[i][1] - mcY;
+            const double dz = P[i][2] - mcZ;
+            Values[i] = dx*dx + dy*dy + dz*dz - R2;
+        }
+    }
+
+
+    virtual std::size_t Compile(FunctionTape<InputType, OutputType>& rTape) const
+    {
+        typedef FunctionTape<InputType, OutputType> TapeType;
+        std::size_t dx = rTape.AddBinary(TapeType::SUBTRACT, rTape.AddVariable(0), rTape.AddConstant(mcX));
+        std::size_t dy = rTape.AddBinary(TapeType::SUBTRACT, rTape.AddVariable(1), rTape.AddConstant(mcY));
+        std::size_t dz = rTape.AddBinary(TapeType::SUBTRACT, rTape.AddVariable(2), rTape.AddConstant(mcZ));
+        std::size_t d2 = rTape.AddBinary(TapeType::ADD, rTape.AddUnary(TapeType::SQUARE, dx), rTape.AddUnary(TapeType::SQUARE, dy));
+        d2 = rTape.AddBinary(TapeType::ADD, d2, rTape.AddUnary(TapeType::SQUARE, dz));
+        return rTape.AddBinary(TapeType::SUBTRACT, d2, rTape.AddConstant(mR*mR));
+    }
+
+
+    virtual void GetGradient(const PointType& P, array_1d<double, 3>& rGradient) const
     {
-        Vector grad(3);
-        grad(0) = 2.0 * (P(0) - mcX);
-        grad(1) = 2.0 * (P(1) - mcY);
-        grad(2) = 2.0 * (P(2) - mcZ);
-        return grad;
+        rGradient[0] = 2.0 * (P(0) - mcX);
+        rGradient[1] = 2.0 * (P(1) - mcY);
+        rGradient[2] = 2.0 * (P(2) - mcZ);
+    }
+
+
+    virtual void GetValueGradientHessian(const PointType& P, double& rValue, array_1d<double, 3>& rGradient,
+            bounded_matrix<double, 3, 3>& rHessian) const
+    {
+        const double dx = P(0) - mcX;
+        const double dy = P(1) - mcY;
+        const double dz = P(2) - mcZ;
+
+        rValue = dx*dx + dy*dy + dz*dz - mR*mR;
+
+        rGradient[0] = 2.0 * dx;
+        rGradient[1] = 2.0 * dy;
+        rGradient[2] = 2.0 * dz;
+
+        noalias(rHessian) = ZeroMatrix(3, 3);
+        rHessian(0, 0) = 2.0;
+        rHessian(1, 1) = 2.0;
+        rHessian(2, 2) = 2.0;
     }
 
     /// projects a point on the surface of level_set
@@ -192,6 +249,20 @@ protected:
     ///@{
 
 
+    /// The gradient is 2(P - c), hence its norm is bounded by the distance to the farthest corner of the box
+    virtual double ComputeLipschitzConstant(const PointType& rMin, const PointType& rMax) const
+    {
+        const double c[] = {mcX, mcY, mcZ};
+        double d2 = 0.0;
+        for(int d = 0; d < 3; ++d)
+        {
+            const double a = std::max(std::fabs(rMin[d] - c[d]), std::fabs(rMax[d] - c[d]));
+            d2 += a*a;
+        }
+        return 2.0*std::sqrt(d2);
+    }
+
+
     ///@}
     ///@name Protected  Access
     ///@{
@@ -231,6 +302,25 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("cX", mcX);
+        rSerializer.save("cY", mcY);
+        rSerializer.save("cZ", mcZ);
+        rSerializer.save("R", mR);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("cX", mcX);
+        rSerializer.load("cY", mcY);
+        rSerializer.load("cZ", mcZ);
+        rSerializer.load("R", mR);
+    }
 
     ///@}
     ///@name Private  Access
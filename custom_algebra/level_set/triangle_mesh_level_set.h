@@ -0,0 +1,915 @@
+//    |  /           |
+//    ' /   __| _` | __|  _ \   __|
+//    . \  |   (   | |   (   |\__ `
+//   _|\_\_|  \__,_|\__|\___/ ____/
+//                   Multi-Physics
+//
+//  License:         brep_application/LICENSE.txt
+//                   Kratos default license: kratos/license.txt
+//
+//  Main authors:    Hoang-Giang Bui
+//  Date:            16 Oct 2026
+//
+
+
+#if !defined(KRATOS_TRIANGLE_MESH_LEVEL_SET_H_INCLUDED )
+#define  KRATOS_TRIANGLE_MESH_LEVEL_SET_H_INCLUDED
+
+
+
+// System includes
+#include <string>
+#include <vector>
+#include <map>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <iostream>
+
+
+// External includes
+
+
+// Project includes
+#include "includes/define.h"
+#include "utilities/openmp_utils.h"
+#include "utilities/math_utils.h"
+#include "custom_algebra/level_set/level_set.h"
+
+
+namespace Kratos
+{
+///@addtogroup BRepApplication
+///@{
+
+///@name Kratos Globals
+///@{
+
+///@}
+///@name Type Definitions
+///@{
+
+///@}
+///@name  Enum's
+///@{
+
+///@}
+///@name  Functions
+///@{
+
+///@}
+///@name Kratos Classes
+///@{
+
+/// Short class definition.
+/** Signed distance to a triangulated surface, e.g. a triangle soup read from a STL/OBJ file.
+ * The coincident vertices of the soup are merged. The closest point is searched in a bounding volume hierarchy
+ * over the triangles. The sign is given by the angle-weighted pseudo-normal of the closest feature (face, edge or
+ * vertex), hence the surface shall be closed and consistently oriented with the normals pointing outwards.
+ * REF: Baerentzen and Aanaes, Signed distance computation using the angle weighted pseudonormal
+ */
+class TriangleMeshLevelSet : public LevelSet
+{
+public:
+    ///@name Type Definitions
+    ///@{
+
+    /// Pointer definition of TriangleMeshLevelSet
+    KRATOS_CLASS_POINTER_DEFINITION(TriangleMeshLevelSet);
+
+    typedef LevelSet BaseType;
+
+    /// Maximum number of triangles in a leaf of the hierarchy
+    static const std::size_t LEAF_SIZE = 4;
+
+    /// Closest feature of a triangle
+    enum FeatureType {FACE = 0, EDGE_0 = 1, EDGE_1 = 2, EDGE_2 = 3, VERTEX_0 = 4, VERTEX_1 = 5, VERTEX_2 = 6};
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// Default constructor.
+    /// rTriangles contains the three vertex indices of each triangle, ordered counter-clockwise seen from outside.
+    TriangleMeshLevelSet(const std::vector<array_1d<double, 3> >& rVertices, const std::vector<std::size_t>& rTriangles)
+    : BaseType(), mVertices(rVertices), mTriangles(rTriangles)
+    {
+        if(mTriangles.size() == 0 || mTriangles.size() % 3 != 0)
+            KRATOS_THROW_ERROR(std::logic_error, "The number of triangle vertex indices must be a non-zero multiple of 3, it is", mTriangles.size())
+
+        for(std::size_t i = 0; i < mTriangles.size(); ++i)
+            if(mTriangles[i] >= mVertices.size())
+                KRATOS_THROW_ERROR(std::logic_error, "The triangle refers to a non-existing vertex", mTriangles[i])
+
+        this->MergeVertices();
+        this->Initialize();
+    }
+
+    /// Default constructor, only used by the serializer.
+    TriangleMeshLevelSet() : BaseType()
+    {}
+
+    /// Copy constructor.
+    TriangleMeshLevelSet(TriangleMeshLevelSet const& rOther)
+    : BaseType(rOther), mVertices(rOther.mVertices), mTriangles(rOther.mTriangles)
+    , mFaceNormals(rOther.mFaceNormals), mEdgeNormals(rOther.mEdgeNormals), mVertexNormals(rOther.mVertexNormals)
+    , mNodes(rOther.mNodes), mTriangleOrder(rOther.mTriangleOrder)
+    {}
+
+    /// Destructor.
+    virtual ~TriangleMeshLevelSet() {}
+
+
+    ///@}
+    ///@name Operators
+    ///@{
+
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+
+    virtual LevelSet::Pointer CloneLevelSet() const
+    {
+        return LevelSet::Pointer(new TriangleMeshLevelSet(*this));
+    }
+
+
+    virtual std::size_t WorkingSpaceDimension() const
+    {
+        return 3;
+    }
+
+
+    /// The bounding box of the root of the hierarchy
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        if(mNodes.empty())
+            return false;
+
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            rMin[d] = mNodes[0].Min[d];
+            rMax[d] = mNodes[0].Max[d];
+        }
+        return true;
+    }
+
+
+    virtual double GetValue(const PointType& P) const
+    {
+        array_1d<double, 3> C;
+        std::size_t t;
+        int feature;
+        const double d = std::sqrt(this->SearchClosestPoint(P, NumberOfTriangles(), C, t, feature));
+        return this->Sign(P, C, t, feature) * d;
+    }
+
+
+    /// The points are split in one chunk per thread. Within a chunk, the closest triangle of a point is used as the
+    /// initial guess for the next point, which prunes most of the hierarchy for coherent points, e.g. sampled on a grid.
+    virtual void GetValues(const PointType* P, const std::size_t n, double* Values) const
+    {
+        OpenMPUtils::PartitionVector Partitions;
+        const int number_of_threads = (n > 256) ? OpenMPUtils::GetNumThreads() : 1;
+        OpenMPUtils::DivideInPartitions(static_cast<int>(n), number_of_threads, Partitions);
+
+        #pragma omp parallel for if(number_of_threads > 1)
+        for(int k = 0; k < number_of_threads; ++k)
+        {
+            array_1d<double, 3> C;
+            std::size_t t = NumberOfTriangles();
+            int feature;
+            for(int i = Partitions[k]; i < Partitions[k+1]; ++i)
+            {
+                const double d = std::sqrt(this->SearchClosestPoint(P[i], t, C, t, feature));
+                Values[i] = this->Sign(P[i], C, t, feature) * d;
+            }
+        }
+    }
+
+
+    virtual void GetGradient(const PointType& P, array_1d<double, 3>& rGradient) const
+    {
+        std::size_t t = NumberOfTriangles();
+        this->ComputeGradient(P, t, rGradient);
+    }
+
+
+    /// The points are split in chunks and the closest triangle is used as initial guess, as in GetValues
+    virtual void GetGradients(const PointType* P, const std::size_t n, array_1d<double, 3>* Gradients) const
+    {
+        OpenMPUtils::PartitionVector Partitions;
+        const int number_of_threads = (n > 256) ? OpenMPUtils::GetNumThreads() : 1;
+        OpenMPUtils::DivideInPartitions(static_cast<int>(n), number_of_threads, Partitions);
+
+        #pragma omp parallel for if(number_of_threads > 1)
+        for(int k = 0; k < number_of_threads; ++k)
+        {
+            std::size_t t = NumberOfTriangles();
+            for(int i = Partitions[k]; i < Partitions[k+1]; ++i)
+                this->ComputeGradient(P[i], t, Gradients[i]);
+        }
+    }
+
+
+    /// The Hessian of the distance vanishes in the face regions. In the edge and vertex regions it is the one of the
+    /// distance to a line and to a point respectively.
+    virtual void GetGradientDerivatives(const PointType& P, bounded_matrix<double, 3, 3>& rDerivatives) const
+    {
+        array_1d<double, 3> C;
+        std::size_t t;
+        int feature;
+        const double d = std::sqrt(this->SearchClosestPoint(P, NumberOfTriangles(), C, t, feature));
+
+        noalias(rDerivatives) = ZeroMatrix(3, 3);
+        if(feature == FACE || d == 0.0)
+            return;
+
+        const double s = this->Sign(P, C, t, feature);
+        const array_1d<double, 3> n = (P - C) / d;
+        for(std::size_t i = 0; i < 3; ++i)
+            for(std::size_t j = 0; j < 3; ++j)
+                rDerivatives(i, j) = s * ((i == j ? 1.0 : 0.0) - n[i]*n[j]) / d;
+
+        if(feature >= EDGE_0 && feature <= EDGE_2)
+        {
+            const std::size_t k = feature - EDGE_0;
+            array_1d<double, 3> e = mVertices[mTriangles[3*t + (k+1)%3]] - mVertices[mTriangles[3*t + k]];
+            e /= norm_2(e);
+            for(std::size_t i = 0; i < 3; ++i)
+                for(std::size_t j = 0; j < 3; ++j)
+                    rDerivatives(i, j) -= s * e[i]*e[j] / d;
+        }
+    }
+
+
+    /// projects a point on the surface of level_set
+    virtual void ProjectOnSurface(const PointType& P, PointType& Proj) const
+    {
+        array_1d<double, 3> C;
+        std::size_t t;
+        int feature;
+        this->SearchClosestPoint(P, NumberOfTriangles(), C, t, feature);
+        Proj[0] = C[0];
+        Proj[1] = C[1];
+        Proj[2] = C[2];
+    }
+
+
+    ///@}
+    ///@name Access
+    ///@{
+
+
+    std::size_t NumberOfVertices() const
+    {
+        return mVertices.size();
+    }
+
+
+    std::size_t NumberOfTriangles() const
+    {
+        return mTriangles.size() / 3;
+    }
+
+
+    ///@}
+    ///@name Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Input and output
+    ///@{
+
+    /// Turn back information as a string.
+    virtual std::string Info() const
+    {
+        return "Triangle Mesh Level Set";
+    }
+
+    /// Print information about this object.
+    virtual void PrintInfo(std::ostream& rOStream) const
+    {
+        rOStream << Info();
+    }
+
+    /// Print object's data.
+    virtual void PrintData(std::ostream& rOStream) const
+    {
+        rOStream << "Number of vertices: " << NumberOfVertices()
+                 << ", number of triangles: " << NumberOfTriangles()
+                 << ", number of hierarchy nodes: " << mNodes.size();
+    }
+
+
+    ///@}
+    ///@name Friends
+    ///@{
+
+
+    ///@}
+
+protected:
+    ///@name Protected static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Protected member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Protected Operators
+    ///@{
+
+
+    ///@}
+    ///@name Protected Operations
+    ///@{
+
+
+    /// The level set is a signed distance
+    virtual double ComputeLipschitzConstant(const PointType& rMin, const PointType& rMax) const
+    {
+        return 1.0;
+    }
+
+
+    ///@}
+    ///@name Protected  Access
+    ///@{
+
+
+    ///@}
+    ///@name Protected Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Protected LifeCycle
+    ///@{
+
+
+    ///@}
+
+private:
+    ///@name Static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Member Variables
+    ///@{
+
+
+    /// Node of the bounding volume hierarchy. The left child of an inner node follows it in mNodes, the right child
+    /// is at Right. A leaf holds the triangles mTriangleOrder[Begin], ..., mTriangleOrder[End-1].
+    struct BVHNode
+    {
+        array_1d<double, 3> Min;
+        array_1d<double, 3> Max;
+        std::size_t Begin;
+        std::size_t End;
+        std::size_t Right;
+        bool IsLeaf;
+    };
+
+
+    std::vector<array_1d<double, 3> > mVertices;
+    std::vector<std::size_t> mTriangles; // 3 vertex indices per triangle
+    std::vector<array_1d<double, 3> > mFaceNormals; // unit normal of each triangle
+    std::vector<array_1d<double, 3> > mEdgeNormals; // pseudo-normal of the edges (v0,v1), (v1,v2), (v2,v0) of each triangle
+    std::vector<array_1d<double, 3> > mVertexNormals; // angle-weighted pseudo-normal of each vertex
+    std::vector<BVHNode> mNodes;
+    std::vector<std::size_t> mTriangleOrder;
+
+
+    ///@}
+    ///@name Private Operators
+    ///@{
+
+
+    ///@}
+    ///@name Private Operations
+    ///@{
+
+
+    /// Merge the vertices with the same coordinates, hence the triangles of a soup share their edges and vertices
+    void MergeVertices()
+    {
+        const std::size_t nvertices = mVertices.size();
+        std::vector<std::size_t> Order(nvertices);
+        for(std::size_t i = 0; i < nvertices; ++i)
+            Order[i] = i;
+        std::sort(Order.begin(), Order.end(), VertexLess(mVertices));
+
+        std::vector<array_1d<double, 3> > Vertices;
+        std::vector<std::size_t> NewIndex(nvertices);
+        for(std::size_t i = 0; i < nvertices; ++i)
+        {
+            if(i == 0 || VertexLess(mVertices)(Order[i-1], Order[i]))
+                Vertices.push_back(mVertices[Order[i]]);
+            NewIndex[Order[i]] = Vertices.size() - 1;
+        }
+
+        for(std::size_t i = 0; i < mTriangles.size(); ++i)
+            mTriangles[i] = NewIndex[mTriangles[i]];
+
+        mVertices.swap(Vertices);
+    }
+
+
+    /// Compute the pseudo-normals and build the hierarchy
+    void Initialize()
+    {
+        const std::size_t ntriangles = NumberOfTriangles();
+
+        mFaceNormals.resize(ntriangles);
+        mEdgeNormals.resize(3*ntriangles);
+        mVertexNormals.resize(mVertices.size());
+        for(std::size_t i = 0; i < mVertices.size(); ++i)
+            noalias(mVertexNormals[i]) = ZeroVector(3);
+
+        std::vector<double> Angles(3*ntriangles);
+
+        #pragma omp parallel for
+        for(int it = 0; it < static_cast<int>(ntriangles); ++it)
+        {
+            const std::size_t t = static_cast<std::size_t>(it);
+            const array_1d<double, 3>& A = mVertices[mTriangles[3*t]];
+            const array_1d<double, 3>& B = mVertices[mTriangles[3*t+1]];
+            const array_1d<double, 3>& C = mVertices[mTriangles[3*t+2]];
+
+            const array_1d<double, 3> AB = B - A;
+            const array_1d<double, 3> AC = C - A;
+            noalias(mFaceNormals[t]) = MathUtils<double>::CrossProduct(AB, AC);
+            const double area2 = norm_2(mFaceNormals[t]);
+            if(area2 > 0.0)
+                mFaceNormals[t] /= area2;
+
+            for(std::size_t k = 0; k < 3; ++k)
+            {
+                array_1d<double, 3> e1 = mVertices[mTriangles[3*t + (k+1)%3]] - mVertices[mTriangles[3*t + k]];
+                array_1d<double, 3> e2 = mVertices[mTriangles[3*t + (k+2)%3]] - mVertices[mTriangles[3*t + k]];
+                const double l = norm_2(e1) * norm_2(e2);
+                Angles[3*t + k] = (l > 0.0) ? std::acos(std::max(-1.0, std::min(1.0, inner_prod(e1, e2) / l))) : 0.0;
+            }
+        }
+
+        // the vertex and edge pseudo-normals gather the normals of the adjacent triangles
+        std::map<std::pair<std::size_t, std::size_t>, array_1d<double, 3> > EdgeNormals;
+        for(std::size_t t = 0; t < ntriangles; ++t)
+        {
+            for(std::size_t k = 0; k < 3; ++k)
+            {
+                noalias(mVertexNormals[mTriangles[3*t + k]]) += Angles[3*t + k] * mFaceNormals[t];
+
+                const std::pair<std::size_t, std::size_t> edge = EdgeKey(t, k);
+                std::map<std::pair<std::size_t, std::size_t>, array_1d<double, 3> >::iterator it = EdgeNormals.find(edge);
+                if(it == EdgeNormals.end())
+                    EdgeNormals[edge] = mFaceNormals[t];
+                else
+                    noalias(it->second) += mFaceNormals[t];
+            }
+        }
+
+        for(std::size_t t = 0; t < ntriangles; ++t)
+            for(std::size_t k = 0; k < 3; ++k)
+                noalias(mEdgeNormals[3*t + k]) = EdgeNormals[EdgeKey(t, k)];
+
+        this->BuildHierarchy();
+    }
+
+
+    std::pair<std::size_t, std::size_t> EdgeKey(const std::size_t t, const std::size_t k) const
+    {
+        const std::size_t v1 = mTriangles[3*t + k];
+        const std::size_t v2 = mTriangles[3*t + (k+1)%3];
+        return std::make_pair(std::min(v1, v2), std::max(v1, v2));
+    }
+
+
+    /// Build the hierarchy by median split along the largest extent of the triangle centroids. A subtree of m
+    /// triangles occupies at most 2m-1 consecutive nodes, hence the position of each subtree is known in advance.
+    /// The upper levels are built serially, then the subtrees below are built in parallel.
+    void BuildHierarchy()
+    {
+        const std::size_t ntriangles = NumberOfTriangles();
+
+        std::vector<array_1d<double, 3> > Centroids(ntriangles);
+        #pragma omp parallel for
+        for(int it = 0; it < static_cast<int>(ntriangles); ++it)
+        {
+            const std::size_t t = static_cast<std::size_t>(it);
+            noalias(Centroids[t]) = (mVertices[mTriangles[3*t]] + mVertices[mTriangles[3*t+1]] + mVertices[mTriangles[3*t+2]]) / 3.0;
+        }
+
+        mTriangleOrder.resize(ntriangles);
+        for(std::size_t t = 0; t < ntriangles; ++t)
+            mTriangleOrder[t] = t;
+
+        mNodes.resize(2*ntriangles - 1);
+        for(std::size_t i = 0; i < mNodes.size(); ++i)
+        {
+            mNodes[i].IsLeaf = true;
+            mNodes[i].Begin = 0;
+            mNodes[i].End = 0;
+        }
+
+        std::size_t serial_depth = 0;
+        while((static_cast<std::size_t>(1) << serial_depth) < static_cast<std::size_t>(4*OpenMPUtils::GetNumThreads()))
+            ++serial_depth;
+
+        std::vector<std::size_t> Subtrees;
+        this->BuildNode(0, 0, ntriangles, serial_depth, Centroids, Subtrees);
+
+        #pragma omp parallel for schedule(dynamic)
+        for(int i = 0; i < static_cast<int>(Subtrees.size()/3); ++i)
+        {
+            std::vector<std::size_t> Dummy;
+            this->BuildNode(Subtrees[3*i], Subtrees[3*i+1], Subtrees[3*i+2], std::numeric_limits<std::size_t>::max(), Centroids, Dummy);
+        }
+    }
+
+
+    /// Build the subtree of the triangles mTriangleOrder[begin:end] at node. Below max_depth, the subtrees are not
+    /// built but appended to rSubtrees as (node, begin, end).
+    void BuildNode(const std::size_t node, const std::size_t begin, const std::size_t end, const std::size_t max_depth,
+        const std::vector<array_1d<double, 3> >& rCentroids, std::vector<std::size_t>& rSubtrees)
+    {
+        BVHNode& rNode = mNodes[node];
+        rNode.Begin = begin;
+        rNode.End = end;
+
+        array_1d<double, 3> CMin, CMax;
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            rNode.Min[d] = std::numeric_limits<double>::max();
+            rNode.Max[d] = -std::numeric_limits<double>::max();
+            CMin[d] = std::numeric_limits<double>::max();
+            CMax[d] = -std::numeric_limits<double>::max();
+        }
+
+        for(std::size_t i = begin; i < end; ++i)
+        {
+            const std::size_t t = mTriangleOrder[i];
+            for(std::size_t k = 0; k < 3; ++k)
+            {
+                const array_1d<double, 3>& V = mVertices[mTriangles[3*t + k]];
+                for(std::size_t d = 0; d < 3; ++d)
+                {
+                    rNode.Min[d] = std::min(rNode.Min[d], V[d]);
+                    rNode.Max[d] = std::max(rNode.Max[d], V[d]);
+                }
+            }
+            for(std::size_t d = 0; d < 3; ++d)
+            {
+                CMin[d] = std::min(CMin[d], rCentroids[t][d]);
+                CMax[d] = std::max(CMax[d], rCentroids[t][d]);
+            }
+        }
+
+        if(end - begin <= LEAF_SIZE)
+        {
+            rNode.IsLeaf = true;
+            rNode.Right = 0;
+            return;
+        }
+
+        std::size_t axis = 0;
+        for(std::size_t d = 1; d < 3; ++d)
+            if(CMax[d] - CMin[d] > CMax[axis] - CMin[axis])
+                axis = d;
+
+        const std::size_t mid = begin + (end - begin) / 2;
+        std::nth_element(mTriangleOrder.begin() + begin, mTriangleOrder.begin() + mid, mTriangleOrder.begin() + end,
+            CentroidLess(rCentroids, axis));
+
+        rNode.IsLeaf = false;
+        rNode.Right = node + 2*(mid - begin);
+
+        if(max_depth == 0)
+        {
+            rSubtrees.push_back(node + 1);
+            rSubtrees.push_back(begin);
+            rSubtrees.push_back(mid);
+            rSubtrees.push_back(rNode.Right);
+            rSubtrees.push_back(mid);
+            rSubtrees.push_back(end);
+            return;
+        }
+
+        const std::size_t right = rNode.Right;
+        this->BuildNode(node + 1, begin, mid, max_depth - 1, rCentroids, rSubtrees);
+        this->BuildNode(right, mid, end, max_depth - 1, rCentroids, rSubtrees);
+    }
+
+
+    /// Compute the gradient at a point. rTriangle is the initial guess of the closest triangle, it is set to the closest one.
+    void ComputeGradient(const PointType& P, std::size_t& rTriangle, array_1d<double, 3>& rGradient) const
+    {
+        array_1d<double, 3> C;
+        int feature;
+        const double d = std::sqrt(this->SearchClosestPoint(P, rTriangle, C, rTriangle, feature));
+        const double s = this->Sign(P, C, rTriangle, feature);
+
+        if(d > 0.0)
+        {
+            noalias(rGradient) = (s / d) * (P - C);
+        }
+        else
+        {
+            noalias(rGradient) = this->FeatureNormal(rTriangle, feature);
+            rGradient /= norm_2(rGradient);
+        }
+    }
+
+
+    /// Search the closest point on the surface and return the squared distance. The closest point on triangle hint
+    /// (if it is a valid triangle) bounds the search from the start.
+    double SearchClosestPoint(const PointType& P, const std::size_t hint, array_1d<double, 3>& rClosest,
+        std::size_t& rTriangle, int& rFeature) const
+    {
+        double best = std::numeric_limits<double>::max();
+        array_1d<double, 3> C;
+        int feature;
+
+        if(hint < NumberOfTriangles())
+        {
+            best = this->ClosestPointOnTriangle(P, hint, rClosest, rFeature);
+            rTriangle = hint;
+        }
+
+        std::size_t stack[128];
+        std::size_t top = 0;
+        stack[top++] = 0;
+        while(top > 0)
+        {
+            const std::size_t index = stack[--top];
+            const BVHNode& rNode = mNodes[index];
+            if(BoxDistance2(P, rNode) >= best)
+                continue;
+
+            if(rNode.IsLeaf)
+            {
+                for(std::size_t i = rNode.Begin; i < rNode.End; ++i)
+                {
+                    const std::size_t t = mTriangleOrder[i];
+                    const double d2 = this->ClosestPointOnTriangle(P, t, C, feature);
+                    if(d2 < best)
+                    {
+                        best = d2;
+                        noalias(rClosest) = C;
+                        rTriangle = t;
+                        rFeature = feature;
+                    }
+                }
+            }
+            else
+            {
+                // visit the nearer child first
+                const std::size_t left = index + 1;
+                const std::size_t right = rNode.Right;
+                const double dl = BoxDistance2(P, mNodes[left]);
+                const double dr = BoxDistance2(P, mNodes[right]);
+                if(dl < dr)
+                {
+                    stack[top++] = right;
+                    stack[top++] = left;
+                }
+                else
+                {
+                    stack[top++] = left;
+                    stack[top++] = right;
+                }
+            }
+        }
+
+        return best;
+    }
+
+
+    /// Squared distance from a point to the box of a node
+    static double BoxDistance2(const PointType& P, const BVHNode& rNode)
+    {
+        double d2 = 0.0;
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            if(P[d] < rNode.Min[d])
+                d2 += (rNode.Min[d] - P[d]) * (rNode.Min[d] - P[d]);
+            else if(P[d] > rNode.Max[d])
+                d2 += (P[d] - rNode.Max[d]) * (P[d] - rNode.Max[d]);
+        }
+        return d2;
+    }
+
+
+    /// Compute the closest point on a triangle, its feature and the squared distance
+    /// REF: Ericson, Real-Time Collision Detection, section 5.1.5
+    double ClosestPointOnTriangle(const PointType& P, const std::size_t t, array_1d<double, 3>& rClosest, int& rFeature) const
+    {
+        const array_1d<double, 3>& A = mVertices[mTriangles[3*t]];
+        const array_1d<double, 3>& B = mVertices[mTriangles[3*t+1]];
+        const array_1d<double, 3>& C = mVertices[mTriangles[3*t+2]];
+
+        // the vector operations are written component-wise since this is the innermost routine of the search
+        double AB[3], AC[3], AP[3], BP[3], CP[3];
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            AB[d] = B[d] - A[d];
+            AC[d] = C[d] - A[d];
+            AP[d] = P[d] - A[d];
+            BP[d] = P[d] - B[d];
+            CP[d] = P[d] - C[d];
+        }
+
+        const double d1 = AB[0]*AP[0] + AB[1]*AP[1] + AB[2]*AP[2];
+        const double d2 = AC[0]*AP[0] + AC[1]*AP[1] + AC[2]*AP[2];
+        const double d3 = AB[0]*BP[0] + AB[1]*BP[1] + AB[2]*BP[2];
+        const double d4 = AC[0]*BP[0] + AC[1]*BP[1] + AC[2]*BP[2];
+        const double d5 = AB[0]*CP[0] + AB[1]*CP[1] + AB[2]*CP[2];
+        const double d6 = AC[0]*CP[0] + AC[1]*CP[1] + AC[2]*CP[2];
+
+        // closest point as A + v*AB + w*AC
+        double v, w;
+        if(d1 <= 0.0 && d2 <= 0.0)
+        {
+            v = 0.0; w = 0.0;
+            rFeature = VERTEX_0;
+        }
+        else if(d3 >= 0.0 && d4 <= d3)
+        {
+            v = 1.0; w = 0.0;
+            rFeature = VERTEX_1;
+        }
+        else if(d6 >= 0.0 && d5 <= d6)
+        {
+            v = 0.0; w = 1.0;
+            rFeature = VERTEX_2;
+        }
+        else
+        {
+            const double vc = d1*d4 - d3*d2;
+            const double vb = d5*d2 - d1*d6;
+            const double va = d3*d6 - d5*d4;
+
+            if(vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+            {
+                v = d1 / (d1 - d3); w = 0.0;
+                rFeature = EDGE_0;
+            }
+            else if(vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+            {
+                v = 0.0; w = d2 / (d2 - d6);
+                rFeature = EDGE_2;
+            }
+            else if(va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0)
+            {
+                w = (d4 - d3) / ((d4 - d3) + (d5 - d6)); v = 1.0 - w;
+                rFeature = EDGE_1;
+            }
+            else
+            {
+                const double denom = 1.0 / (va + vb + vc);
+                v = vb*denom; w = vc*denom;
+                rFeature = FACE;
+            }
+        }
+
+        double dist2 = 0.0;
+        for(std::size_t d = 0; d < 3; ++d)
+        {
+            rClosest[d] = A[d] + v*AB[d] + w*AC[d];
+            dist2 += (P[d] - rClosest[d]) * (P[d] - rClosest[d]);
+        }
+        return dist2;
+    }
+
+
+    /// Get the pseudo-normal of a feature of a triangle
+    const array_1d<double, 3>& FeatureNormal(const std::size_t t, const int feature) const
+    {
+        if(feature == FACE)
+            return mFaceNormals[t];
+        else if(feature <= EDGE_2)
+            return mEdgeNormals[3*t + feature - EDGE_0];
+        else
+            return mVertexNormals[mTriangles[3*t + feature - VERTEX_0]];
+    }
+
+
+    /// Get the sign of the distance from the pseudo-normal of the closest feature
+    double Sign(const PointType& P, const array_1d<double, 3>& rClosest, const std::size_t t, const int feature) const
+    {
+        const array_1d<double, 3>& N = this->FeatureNormal(t, feature);
+        const double s = (P[0] - rClosest[0])*N[0] + (P[1] - rClosest[1])*N[1] + (P[2] - rClosest[2])*N[2];
+        return (s < 0.0) ? -1.0 : 1.0;
+    }
+
+
+    /// Lexicographic order of the vertices
+    struct VertexLess
+    {
+        VertexLess(const std::vector<array_1d<double, 3> >& rVertices) : mrVertices(rVertices) {}
+        bool operator()(const std::size_t i, const std::size_t j) const
+        {
+            for(std::size_t d = 0; d < 3; ++d)
+            {
+                if(mrVertices[i][d] < mrVertices[j][d])
+                    return true;
+                if(mrVertices[i][d] > mrVertices[j][d])
+                    return false;
+            }
+            return false;
+        }
+        const std::vector<array_1d<double, 3> >& mrVertices;
+    };
+
+
+    /// Order of the triangles by a coordinate of the centroid
+    struct CentroidLess
+    {
+        CentroidLess(const std::vector<array_1d<double, 3> >& rCentroids, const std::size_t axis) : mrCentroids(rCentroids), mAxis(axis) {}
+        bool operator()(const std::size_t i, const std::size_t j) const
+        {
+            return mrCentroids[i][mAxis] < mrCentroids[j][mAxis];
+        }
+        const std::vector<array_1d<double, 3> >& mrCentroids;
+        std::size_t mAxis;
+    };
+
+
+    friend class Serializer;
+
+    /// Only the mesh is saved, the pseudo-normals and the hierarchy are rebuilt on loading
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("Vertices", mVertices);
+        rSerializer.save("Triangles", mTriangles);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("Vertices", mVertices);
+        rSerializer.load("Triangles", mTriangles);
+        this->Initialize();
+    }
+
+    ///@}
+    ///@name Private  Access
+    ///@{
+
+
+    ///@}
+    ///@name Private Inquiry
+    ///@{
+
+
+    ///@}
+    ///@name Un accessible methods
+    ///@{
+
+    /// Assignment operator.
+    TriangleMeshLevelSet& operator=(TriangleMeshLevelSet const& rOther);
+
+    ///@}
+
+}; // Class TriangleMeshLevelSet
+
+///@}
+
+///@name Type Definitions
+///@{
+
+
+///@}
+///@name Input and output
+///@{
+
+
+/// input stream function
+inline std::istream& operator >> (std::istream& rIStream, TriangleMeshLevelSet& rThis)
+{}
+
+/// output stream function
+inline std::ostream& operator << (std::ostream& rOStream, const TriangleMeshLevelSet& rThis)
+{
+    rThis.PrintInfo(rOStream);
+    rOStream << std::endl;
+    rThis.PrintData(rOStream);
+
+    return rOStream;
+}
+///@}
+
+///@} addtogroup block
+
+}  // namespace Kratos.
+
+#endif // KRATOS_TRIANGLE_MESH_LEVEL_SET_H_INCLUDED  defined
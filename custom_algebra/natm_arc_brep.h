@@ -59,6 +59,30 @@ struct NATMArc
     double X, Y, R;
     double Alpha1, Alpha2;
     double Angle1, Angle2, Angle3;
+
+    void save(Serializer& rSerializer) const
+    {
+        rSerializer.save("X", X);
+        rSerializer.save("Y", Y);
+        rSerializer.save("R", R);
+        rSerializer.save("Alpha1", Alpha1);
+        rSerializer.save("Alpha2", Alpha2);
+        rSerializer.save("Angle1", Angle1);
+        rSerializer.save("Angle2", Angle2);
+        rSerializer.save("Angle3", Angle3);
+    }
+
+    void load(Serializer& rSerializer)
+    {
+        rSerializer.load("X", X);
+        rSerializer.load("Y", Y);
+        rSerializer.load("R", R);
+        rSerializer.load("Alpha1", Alpha1);
+        rSerializer.load("Alpha2", Alpha2);
+        rSerializer.load("Angle1", Angle1);
+        rSerializer.load("Angle2", Angle2);
+        rSerializer.load("Angle3", Angle3);
+    }
 };
 
 inline std::ostream& operator << (std::ostream& rOStream, const NATMArc& rThis)
@@ -199,6 +223,28 @@ public:
         return 1;
     }
 
+    /// Get the bounding box of the profile, which is extruded along z. The profile is star-shaped w.r.t the
+    /// reference center and bounded by the arcs, hence it lies within the boxes of the full circles and the center.
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        if (mArcs.size() == 0)
+            return false;
+
+        rMin[0] = rMax[0] = mRefCenter[0];
+        rMin[1] = rMax[1] = mRefCenter[1];
+        for (std::size_t i = 0; i < mArcs.size(); ++i)
+        {
+            rMin[0] = std::min(rMin[0], mArcs[i].X - mArcs[i].R);
+            rMax[0] = std::max(rMax[0], mArcs[i].X + mArcs[i].R);
+            rMin[1] = std::min(rMin[1], mArcs[i].Y - mArcs[i].R);
+            rMax[1] = std::max(rMax[1], mArcs[i].Y + mArcs[i].R);
+        }
+        rMin[2] = -std::numeric_limits<double>::infinity();
+        rMax[2] = std::numeric_limits<double>::infinity();
+
+        return true;
+    }
+
     /// Check if a point is inside/outside of the NATMArcBRep
     virtual bool IsInside(const PointType& P) const
     {
@@ -414,6 +460,23 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("RefAngle", mRefAngle);
+        rSerializer.save("RefCenter", mRefCenter);
+        rSerializer.save("Arcs", mArcs);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("RefAngle", mRefAngle);
+        rSerializer.load("RefCenter", mRefCenter);
+        rSerializer.load("Arcs", mArcs);
+    }
 
     ///@}
     ///@name Private  Access
@@ -30,6 +30,8 @@
 #include "includes/element.h"
 #include "includes/ublas_interface.h"
 #include "geometries/geometry_data.h"
+#include "custom_algebra/brep.h"
+#include "custom_algebra/level_set/level_set.h"
 
 
 namespace Kratos
@@ -85,6 +87,10 @@ public:
     : mpBRep(pBRep), BaseType()
     {}
 
+    /// Default constructor, only used by the serializer.
+    NotBRep() : BaseType()
+    {}
+
     /// Copy constructor.
     NotBRep(NotBRep const& rOther)
     : BaseType(rOther)
@@ -126,6 +132,18 @@ public:
         return !mpBRep->IsInside(P);
     }
 
+    /// The inside and the outside of the BRep are swapped
+    virtual int CutStatusOfBox(const PointType& rMin, const PointType& rMax) const
+    {
+        const int stat = mpBRep->CutStatusOfBox(rMin, rMax);
+        if(stat == _IN)
+            return _OUT;
+        else if(stat == _OUT)
+            return _IN;
+        else
+            return _CUT;
+    }
+
     /// Check if a geometry is cut by the level set
     /// 0: the cell is completely inside the domain bounded by level set
     /// 1: completely outside
@@ -253,6 +271,9 @@ private:
 
     BRep::Pointer mpBRep;
 
+    /// The operand if it is a level set, as loaded by the serializer
+    LevelSet::Pointer mpLevelSet;
+
     ///@}
     ///@name Private Operators
     ///@{
@@ -262,6 +283,19 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        LevelSet::SaveBRep(rSerializer, "BRep", mpBRep);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        LevelSet::LoadBRep(rSerializer, "BRep", mpBRep, mpLevelSet);
+    }
 
     ///@}
     ///@name Private  Access
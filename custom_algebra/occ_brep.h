@@ -23,8 +23,17 @@
 
 
 // External includes
+#include <TopoDS.hxx>
 #include <TopoDS_Shape.hxx>
+#include <TopoDS_Vertex.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopExp_Explorer.hxx>
 #include <gp_Pnt.hxx>
+#include <Bnd_Box.hxx>
+#include <BRep_Builder.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_MakeVertex.hxx>
+#include <BRepExtrema_DistShapeShape.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
 
 
@@ -87,11 +96,12 @@ public:
     ///@{
 
     /// Default constructor.
-    OCCBRep() : BaseType()
+    OCCBRep() : BaseType(), mIsBounded(false)
     {}
 
     /// Copy constructor.
-    OCCBRep(OCCBRep const& rOther) : BaseType(rOther), mpShape(rOther.mpShape)
+    OCCBRep(OCCBRep const& rOther) : BaseType(rOther), mpShape(rOther.mpShape), mBoundary(rOther.mBoundary)
+    , mIsBounded(rOther.mIsBounded), mBoundingMin(rOther.mBoundingMin), mBoundingMax(rOther.mBoundingMax)
     {}
 
     /// Destructor.
@@ -109,9 +119,26 @@ public:
     ///@{
 
     /// Set the underlying OCC geometry
+    /// The bounding box and the compound of the faces of the shape are computed once here
     void SetShape(OCC::shared_ptr<TopoDS_Shape> pShape)
     {
         mpShape = pShape;
+
+        BRep_Builder Builder;
+        Builder.MakeCompound(mBoundary);
+        for (TopExp_Explorer Explorer(*mpShape, TopAbs_FACE); Explorer.More(); Explorer.Next())
+            Builder.Add(mBoundary, Explorer.Current());
+
+        Bnd_Box Box;
+        BRepBndLib::Add(*mpShape, Box);
+        mIsBounded = !Box.IsVoid();
+        if (mIsBounded)
+        {
+            Standard_Real xmin, ymin, zmin, xmax, ymax, zmax;
+            Box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+            mBoundingMin[0] = xmin; mBoundingMin[1] = ymin; mBoundingMin[2] = zmin;
+            mBoundingMax[0] = xmax; mBoundingMax[1] = ymax; mBoundingMax[2] = zmax;
+        }
     }
 
     /// Clone this OCCBRep
@@ -132,6 +159,40 @@ public:
         KRATOS_THROW_ERROR(std::logic_error, "Calling the base class", __FUNCTION__)
     }
 
+    /// Get the bounding box of the shape
+    virtual bool GetBoundingBox(PointType& rMin, PointType& rMax) const
+    {
+        if (!mIsBounded)
+            return false;
+
+        noalias(rMin) = mBoundingMin;
+        noalias(rMax) = mBoundingMax;
+        return true;
+    }
+
+    /// Check if an axis-aligned box is cut by the OCCBRep without sampling the box. Besides the bounding box, the box is
+    /// completely inside or outside if the distance from its center to the faces of the shape is larger than its
+    /// half-diagonal; the status is then the status of the center.
+    virtual int CutStatusOfBoxByBounds(const PointType& rMin, const PointType& rMax) const
+    {
+        const int stat = BaseType::CutStatusOfBox(rMin, rMax);
+        if (stat != BRep::_CUT || mpShape == NULL)
+            return stat;
+
+        PointType C;
+        noalias(C) = 0.5 * (rMin + rMax);
+        const double radius = 0.5 * norm_2(rMax - rMin);
+
+        TopoDS_Vertex Vertex = BRepBuilderAPI_MakeVertex(gp_Pnt(C[0], C[1], C[2]));
+        BRepExtrema_DistShapeShape Distance(Vertex, mBoundary);
+        if (!Distance.IsDone() || Distance.NbSolution() == 0)
+            return BRep::_CUT;
+        if (!(Distance.Value() > radius + this->GetTolerance()))
+            return BRep::_CUT;
+
+        return this->IsInside(C) ? BRep::_IN : BRep::_OUT;
+    }
+
     /// Check if a point is inside/outside of the OCCBRep
     // REF: https://www.opencascade.com/content/point-inside-solid-or-not
     virtual bool IsInside(const PointType& P) const
@@ -247,6 +308,9 @@ private:
     ///@{
 
     OCC::shared_ptr<TopoDS_Shape> mpShape;
+    TopoDS_Compound mBoundary; // the faces of the shape, to compute the distance to the boundary
+    bool mIsBounded;
+    PointType mBoundingMin, mBoundingMax;
 
     ///@}
     ///@name Private Operators
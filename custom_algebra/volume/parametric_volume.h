@@ -86,6 +86,10 @@ public:
     : BaseType(), mp_func_x(p_func_x), mp_func_y(p_func_y), mp_func_z(p_func_z)
     {}
 
+    /// Default constructor, only used by the serializer.
+    ParametricVolume() : BaseType()
+    {}
+
     /// Copy constructor.
     ParametricVolume(ParametricVolume const& rOther)
     : BaseType(rOther)
@@ -239,6 +243,23 @@ private:
     ///@name Private Operations
     ///@{
 
+    friend class Serializer;
+
+    virtual void save(Serializer& rSerializer) const
+    {
+        KRATOS_SERIALIZE_SAVE_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.save("FunctionX", mp_func_x);
+        rSerializer.save("FunctionY", mp_func_y);
+        rSerializer.save("FunctionZ", mp_func_z);
+    }
+
+    virtual void load(Serializer& rSerializer)
+    {
+        KRATOS_SERIALIZE_LOAD_BASE_CLASS(rSerializer, BaseType)
+        rSerializer.load("FunctionX", mp_func_x);
+        rSerializer.load("FunctionY", mp_func_y);
+        rSerializer.load("FunctionZ", mp_func_z);
+    }
 
     ///@}
     ///@name Private  Access
@@ -44,39 +44,30 @@ namespace
 namespace tk
 {
 
-// band matrix solver
-class band_matrix
+// solves the tridiagonal system
+//   lower[i]*x[i-1] + diag[i]*x[i] + upper[i]*x[i+1] = rhs[i]
+// by the Thomas algorithm, i.e. Gauss elimination without pivoting,
+// which is stable for the diagonally dominant spline systems.
+// diag and rhs are overwritten, the solution is returned in rhs.
+inline void thomas_solve(const std::vector<double>& lower,
+                         std::vector<double>& diag,
+                         const std::vector<double>& upper,
+                         std::vector<double>& rhs)
 {
-private:
-    std::vector< std::vector<double> > m_upper;  // upper band
-    std::vector< std::vector<double> > m_lower;  // lower band
-public:
-    band_matrix() {};                             // constructor
-    band_matrix(int dim, int n_u, int n_l);       // constructor
-    ~band_matrix() {};                            // destructor
-    void resize(int dim, int n_u, int n_l);      // init with dim,n_u,n_l
-    int dim() const;                             // matrix dimension
-    int num_upper() const
-    {
-        return m_upper.size()-1;
+    const int n=diag.size();
+    assert(n>0);
+    for(int i=1; i<n; i++) {
+        assert(diag[i-1]!=0.0);
+        const double m=lower[i]/diag[i-1];
+        diag[i]-=m*upper[i-1];
+        rhs[i]-=m*rhs[i-1];
     }
-    int num_lower() const
-    {
-        return m_lower.size()-1;
+    assert(diag[n-1]!=0.0);
+    rhs[n-1]/=diag[n-1];
+    for(int i=n-2; i>=0; i--) {
+        rhs[i]=(rhs[i]-upper[i]*rhs[i+1])/diag[i];
     }
-    // access operator
-    double & operator () (int i, int j);            // write
-    double   operator () (int i, int j) const;      // read
-    // we can store an additional diogonal (in m_lower)
-    double& saved_diag(int i);
-    double  saved_diag(int i) const;
-    void lu_decompose();
-    std::vector<double> r_solve(const std::vector<double>& b) const;
-    std::vector<double> l_solve(const std::vector<double>& b) const;
-    std::vector<double> lu_solve(const std::vector<double>& b,
-                                 bool is_lu_decomposed=false);
-
-};
+}
 
 
 // spline interpolation
@@ -88,11 +79,17 @@ public:
         second_deriv = 2
     };
 
+    // interpolation parameters of the interval [x_i, x_{i+1}]
+    // f(x) = a*(x-x_i)^3 + b*(x-x_i)^2 + c*(x-x_i) + d
+    // they are kept together so that an evaluation touches one cache line
+    struct coefficients
+    {
+        double x0, a, b, c, d;
+    };
+
 private:
     std::vector<double> m_x,m_y;            // x,y coordinates of points
-    // interpolation parameters
-    // f(x) = a*(x-x_i)^3 + b*(x-x_i)^2 + c*(x-x_i) + y_i
-    std::vector<double> m_a,m_b,m_c;        // spline coefficients
+    std::vector<coefficients> m_coef;       // spline coefficients of each interval
     double  m_b0, m_c0;                     // for left extrapol
     bd_type m_left, m_right;
     double  m_left_value, m_right_value;
@@ -112,9 +109,7 @@ public:
     {
         this->m_x = r_other.m_x;
         this->m_y = r_other.m_y;
-        this->m_a = r_other.m_a;
-        this->m_b = r_other.m_b;
-        this->m_c = r_other.m_c;
+        this->m_coef = r_other.m_coef;
         this->m_b0 = r_other.m_b0;
         this->m_c0 = r_other.m_c0;
         this->m_left = r_other.m_left;
@@ -134,9 +129,27 @@ public:
                     const std::vector<double>& y, bool cubic_spline=true);
     double operator() (double x) const;
     double deriv(int order, double x) const;
+    // evaluate the derivatives of order, order+1 and order+2 (order 0 is the value)
+    // at n points; if the points are sorted, the intervals are found by walking
+    // forward from the previous one instead of searching for each point.
+    // any of the output arrays may be NULL.
+    void eval_sorted(const double* x, size_t n, int order,
+                     double* d0, double* d1, double* d2) const;
     const std::vector<double>& x() const {return m_x;}
     const std::vector<double>& y() const {return m_y;}
+    // the full state of the spline, i.e. points, boundary conditions and
+    // coefficients, as a flat array. set_state() restores a spline without
+    // solving the equation system again.
+    void get_state(std::vector<double>& state) const;
+    void set_state(const std::vector<double>& state);
     void write(const std::string& filename, const int& nsampling) const;
+private:
+    // find the closest point m_x[idx] < x, idx=0 even if x<m_x[0]
+    int find_interval(double x) const;
+    // derivatives of order 0,...,3 at x in the interval idx
+    void eval_all(int idx, double x, double* d) const;
+    // derivative of given order at x in the interval idx
+    double eval(int idx, int order, double x) const;
 };
 
 
@@ -146,151 +159,6 @@ public:
 // ---------------------------------------------------------------------
 
 
-// band_matrix implementation
-// -------------------------
-
-band_matrix::band_matrix(int dim, int n_u, int n_l)
-{
-    resize(dim, n_u, n_l);
-}
-void band_matrix::resize(int dim, int n_u, int n_l)
-{
-    assert(dim>0);
-    assert(n_u>=0);
-    assert(n_l>=0);
-    m_upper.resize(n_u+1);
-    m_lower.resize(n_l+1);
-    for(size_t i=0; i<m_upper.size(); i++) {
-        m_upper[i].resize(dim);
-    }
-    for(size_t i=0; i<m_lower.size(); i++) {
-        m_lower[i].resize(dim);
-    }
-}
-int band_matrix::dim() const
-{
-    if(m_upper.size()>0) {
-        return m_upper[0].size();
-    } else {
-        return 0;
-    }
-}
-
-
-// defines the new operator (), so that we can access the elements
-// by A(i,j), index going from i=0,...,dim()-1
-double & band_matrix::operator () (int i, int j)
-{
-    int k=j-i;       // what band is the entry
-    assert( (i>=0) && (i<dim()) && (j>=0) && (j<dim()) );
-    assert( (-num_lower()<=k) && (k<=num_upper()) );
-    // k=0 -> diogonal, k<0 lower left part, k>0 upper right part
-    if(k>=0)   return m_upper[k][i];
-    else	    return m_lower[-k][i];
-}
-double band_matrix::operator () (int i, int j) const
-{
-    int k=j-i;       // what band is the entry
-    assert( (i>=0) && (i<dim()) && (j>=0) && (j<dim()) );
-    assert( (-num_lower()<=k) && (k<=num_upper()) );
-    // k=0 -> diogonal, k<0 lower left part, k>0 upper right part
-    if(k>=0)   return m_upper[k][i];
-    else	    return m_lower[-k][i];
-}
-// second diag (used in LU decomposition), saved in m_lower
-double band_matrix::saved_diag(int i) const
-{
-    assert( (i>=0) && (i<dim()) );
-    return m_lower[0][i];
-}
-double & band_matrix::saved_diag(int i)
-{
-    assert( (i>=0) && (i<dim()) );
-    return m_lower[0][i];
-}
-
-// LR-Decomposition of a band matrix
-void band_matrix::lu_decompose()
-{
-    int  i_max,j_max;
-    int  j_min;
-    double x;
-
-    // preconditioning
-    // normalize column i so that a_ii=1
-    for(int i=0; i<this->dim(); i++) {
-        assert(this->operator()(i,i)!=0.0);
-        this->saved_diag(i)=1.0/this->operator()(i,i);
-        j_min=std::max(0,i-this->num_lower());
-        j_max=std::min(this->dim()-1,i+this->num_upper());
-        for(int j=j_min; j<=j_max; j++) {
-            this->operator()(i,j) *= this->saved_diag(i);
-        }
-        this->operator()(i,i)=1.0;          // prevents rounding errors
-    }
-
-    // Gauss LR-Decomposition
-    for(int k=0; k<this->dim(); k++) {
-        i_max=std::min(this->dim()-1,k+this->num_lower());  // num_lower not a mistake!
-        for(int i=k+1; i<=i_max; i++) {
-            assert(this->operator()(k,k)!=0.0);
-            x=-this->operator()(i,k)/this->operator()(k,k);
-            this->operator()(i,k)=-x;                         // assembly part of L
-            j_max=std::min(this->dim()-1,k+this->num_upper());
-            for(int j=k+1; j<=j_max; j++) {
-                // assembly part of R
-                this->operator()(i,j)=this->operator()(i,j)+x*this->operator()(k,j);
-            }
-        }
-    }
-}
-// solves Ly=b
-std::vector<double> band_matrix::l_solve(const std::vector<double>& b) const
-{
-    assert( this->dim()==(int)b.size() );
-    std::vector<double> x(this->dim());
-    int j_start;
-    double sum;
-    for(int i=0; i<this->dim(); i++) {
-        sum=0;
-        j_start=std::max(0,i-this->num_lower());
-        for(int j=j_start; j<i; j++) sum += this->operator()(i,j)*x[j];
-        x[i]=(b[i]*this->saved_diag(i)) - sum;
-    }
-    return x;
-}
-// solves Rx=y
-std::vector<double> band_matrix::r_solve(const std::vector<double>& b) const
-{
-    assert( this->dim()==(int)b.size() );
-    std::vector<double> x(this->dim());
-    int j_stop;
-    double sum;
-    for(int i=this->dim()-1; i>=0; i--) {
-        sum=0;
-        j_stop=std::min(this->dim()-1,i+this->num_upper());
-        for(int j=i+1; j<=j_stop; j++) sum += this->operator()(i,j)*x[j];
-        x[i]=( b[i] - sum ) / this->operator()(i,i);
-    }
-    return x;
-}
-
-std::vector<double> band_matrix::lu_solve(const std::vector<double>& b,
-        bool is_lu_decomposed)
-{
-    assert( this->dim()==(int)b.size() );
-    std::vector<double>  x,y;
-    if(is_lu_decomposed==false) {
-        this->lu_decompose();
-    }
-    y=this->l_solve(b);
-    x=this->r_solve(y);
-    return x;
-}
-
-
-
-
 // spline implementation
 // -----------------------
 
@@ -334,163 +202,219 @@ void spline::set_points(const std::vector<double>& x,
         assert(m_x[i]<m_x[i+1]);
     }
 
+    m_coef.resize(n);
+    for(int i=0; i<n; i++) {
+        m_coef[i].x0=x[i];
+        m_coef[i].d=y[i];
+    }
+
     if(cubic_spline==true) { // cubic spline interpolation
-        // setting up the matrix and right hand side of the equation system
-        // for the parameters b[]
-        band_matrix A(n,1,1);
-        std::vector<double>  rhs(n);
+        // setting up the tridiagonal matrix and right hand side of the
+        // equation system for the parameters b[]
+        std::vector<double> lower(n), diag(n), upper(n), rhs(n);
         for(int i=1; i<n-1; i++) {
-            A(i,i-1)=1.0/3.0*(x[i]-x[i-1]);
-            A(i,i)=2.0/3.0*(x[i+1]-x[i-1]);
-            A(i,i+1)=1.0/3.0*(x[i+1]-x[i]);
+            lower[i]=1.0/3.0*(x[i]-x[i-1]);
+            diag[i]=2.0/3.0*(x[i+1]-x[i-1]);
+            upper[i]=1.0/3.0*(x[i+1]-x[i]);
             rhs[i]=(y[i+1]-y[i])/(x[i+1]-x[i]) - (y[i]-y[i-1])/(x[i]-x[i-1]);
         }
         // boundary conditions
+        lower[0]=0.0;
         if(m_left == spline::second_deriv) {
             // 2*b[0] = f''
-            A(0,0)=2.0;
-            A(0,1)=0.0;
+            diag[0]=2.0;
+            upper[0]=0.0;
             rhs[0]=m_left_value;
         } else if(m_left == spline::first_deriv) {
             // c[0] = f', needs to be re-expressed in terms of b:
             // (2b[0]+b[1])(x[1]-x[0]) = 3 ((y[1]-y[0])/(x[1]-x[0]) - f')
-            A(0,0)=2.0*(x[1]-x[0]);
-            A(0,1)=1.0*(x[1]-x[0]);
+            diag[0]=2.0*(x[1]-x[0]);
+            upper[0]=1.0*(x[1]-x[0]);
             rhs[0]=3.0*((y[1]-y[0])/(x[1]-x[0])-m_left_value);
         } else {
             assert(false);
         }
+        upper[n-1]=0.0;
         if(m_right == spline::second_deriv) {
             // 2*b[n-1] = f''
-            A(n-1,n-1)=2.0;
-            A(n-1,n-2)=0.0;
+            diag[n-1]=2.0;
+            lower[n-1]=0.0;
             rhs[n-1]=m_right_value;
         } else if(m_right == spline::first_deriv) {
             // c[n-1] = f', needs to be re-expressed in terms of b:
             // (b[n-2]+2b[n-1])(x[n-1]-x[n-2])
             // = 3 (f' - (y[n-1]-y[n-2])/(x[n-1]-x[n-2]))
-            A(n-1,n-1)=2.0*(x[n-1]-x[n-2]);
-            A(n-1,n-2)=1.0*(x[n-1]-x[n-2]);
+            diag[n-1]=2.0*(x[n-1]-x[n-2]);
+            lower[n-1]=1.0*(x[n-1]-x[n-2]);
             rhs[n-1]=3.0*(m_right_value-(y[n-1]-y[n-2])/(x[n-1]-x[n-2]));
         } else {
             assert(false);
         }
 
         // solve the equation system to obtain the parameters b[]
-        m_b=A.lu_solve(rhs);
+        thomas_solve(lower, diag, upper, rhs);
 
         // calculate parameters a[] and c[] based on b[]
-        m_a.resize(n);
-        m_c.resize(n);
+        for(int i=0; i<n; i++) {
+            m_coef[i].b=rhs[i];
+        }
         for(int i=0; i<n-1; i++) {
-            m_a[i]=1.0/3.0*(m_b[i+1]-m_b[i])/(x[i+1]-x[i]);
-            m_c[i]=(y[i+1]-y[i])/(x[i+1]-x[i])
-                   - 1.0/3.0*(2.0*m_b[i]+m_b[i+1])*(x[i+1]-x[i]);
+            m_coef[i].a=1.0/3.0*(rhs[i+1]-rhs[i])/(x[i+1]-x[i]);
+            m_coef[i].c=(y[i+1]-y[i])/(x[i+1]-x[i])
+                        - 1.0/3.0*(2.0*rhs[i]+rhs[i+1])*(x[i+1]-x[i]);
         }
     } else { // linear interpolation
-        m_a.resize(n);
-        m_b.resize(n);
-        m_c.resize(n);
+        for(int i=0; i<n; i++) {
+            m_coef[i].a=0.0;
+            m_coef[i].b=0.0;
+            m_coef[i].c=0.0;
+        }
         for(int i=0; i<n-1; i++) {
-            m_a[i]=0.0;
-            m_b[i]=0.0;
-            m_c[i]=(m_y[i+1]-m_y[i])/(m_x[i+1]-m_x[i]);
+            m_coef[i].c=(m_y[i+1]-m_y[i])/(m_x[i+1]-m_x[i]);
         }
     }
 
     // for left extrapolation coefficients
-    m_b0 = (m_force_linear_extrapolation==false) ? m_b[0] : 0.0;
-    m_c0 = m_c[0];
+    m_b0 = (m_force_linear_extrapolation==false) ? m_coef[0].b : 0.0;
+    m_c0 = m_coef[0].c;
 
     // for the right extrapolation coefficients
     // f_{n-1}(x) = b*(x-x_{n-1})^2 + c*(x-x_{n-1}) + y_{n-1}
     double h=x[n-1]-x[n-2];
-    // m_b[n-1] is determined by the boundary condition
-    m_a[n-1]=0.0;
-    m_c[n-1]=3.0*m_a[n-2]*h*h+2.0*m_b[n-2]*h+m_c[n-2];   // = f'_{n-2}(x_{n-1})
+    const coefficients& p=m_coef[n-2];
+    // m_coef[n-1].b is determined by the boundary condition
+    m_coef[n-1].a=0.0;
+    m_coef[n-1].c=3.0*p.a*h*h+2.0*p.b*h+p.c;   // = f'_{n-2}(x_{n-1})
     if(m_force_linear_extrapolation==true)
-        m_b[n-1]=0.0;
+        m_coef[n-1].b=0.0;
 }
 
-double spline::operator() (double x) const
+
+int spline::find_interval(double x) const
 {
-    size_t n=m_x.size();
-    // find the closest point m_x[idx] < x, idx=0 even if x<m_x[0]
     std::vector<double>::const_iterator it;
     it=std::lower_bound(m_x.begin(),m_x.end(),x);
-    int idx=std::max( int(it-m_x.begin())-1, 0);
+    return std::max( int(it-m_x.begin())-1, 0);
+}
 
-    double h=x-m_x[idx];
-    double interpol;
-    if(x<m_x[0]) {
+void spline::eval_all(int idx, double x, double* d) const
+{
+    size_t n=m_coef.size();
+    if(x<m_coef[0].x0) {
         // extrapolation to the left
-        interpol=(m_b0*h + m_c0)*h + m_y[0];
-    } else if(x>m_x[n-1]) {
-        // extrapolation to the right
-        interpol=(m_b[n-1]*h + m_c[n-1])*h + m_y[n-1];
+        const double h=x-m_coef[0].x0;
+        d[0]=(m_b0*h + m_c0)*h + m_coef[0].d;
+        d[1]=2.0*m_b0*h + m_c0;
+        d[2]=2.0*m_b0;
+        d[3]=0.0;
     } else {
-        // interpolation
-        interpol=((m_a[idx]*h + m_b[idx])*h + m_c[idx])*h + m_y[idx];
+        // interpolation, or extrapolation to the right with the last
+        // coefficients, for which a=0
+        const coefficients& p=(x>m_coef[n-1].x0) ? m_coef[n-1] : m_coef[idx];
+        const double h=x-p.x0;
+        d[0]=((p.a*h + p.b)*h + p.c)*h + p.d;
+        d[1]=(3.0*p.a*h + 2.0*p.b)*h + p.c;
+        d[2]=6.0*p.a*h + 2.0*p.b;
+        d[3]=6.0*p.a;
     }
-    return interpol;
+}
+
+double spline::eval(int idx, int order, double x) const
+{
+    if(order>3) return 0.0;
+    double d[4];
+    eval_all(idx, x, d);
+    return d[order];
+}
+
+double spline::operator() (double x) const
+{
+    return eval(find_interval(x), 0, x);
 }
 
 double spline::deriv(int order, double x) const
 {
     assert(order>0);
+    return eval(find_interval(x), order, x);
+}
 
-    size_t n=m_x.size();
-    // find the closest point m_x[idx] < x, idx=0 even if x<m_x[0]
-    std::vector<double>::const_iterator it;
-    it=std::lower_bound(m_x.begin(),m_x.end(),x);
-    int idx=std::max( int(it-m_x.begin())-1, 0);
-
-    double h=x-m_x[idx];
-    double interpol;
-    if(x<m_x[0]) {
-        // extrapolation to the left
-        switch(order) {
-        case 1:
-            interpol=2.0*m_b0*h + m_c0;
-            break;
-        case 2:
-            interpol=2.0*m_b0*h;
-            break;
-        default:
-            interpol=0.0;
-            break;
-        }
-    } else if(x>m_x[n-1]) {
-        // extrapolation to the right
-        switch(order) {
-        case 1:
-            interpol=2.0*m_b[n-1]*h + m_c[n-1];
-            break;
-        case 2:
-            interpol=2.0*m_b[n-1];
-            break;
-        default:
-            interpol=0.0;
-            break;
-        }
-    } else {
-        // interpolation
-        switch(order) {
-        case 1:
-            interpol=(3.0*m_a[idx]*h + 2.0*m_b[idx])*h + m_c[idx];
-            break;
-        case 2:
-            interpol=6.0*m_a[idx]*h + 2.0*m_b[idx];
-            break;
-        case 3:
-            interpol=6.0*m_a[idx];
-            break;
-        default:
-            interpol=0.0;
-            break;
+void spline::eval_sorted(const double* x, size_t n, int order,
+                         double* d0, double* d1, double* d2) const
+{
+    assert(order>=0);
+    if(n==0) return;
+
+    const int nx=m_x.size();
+    int idx=find_interval(x[0]);
+    double d[6];
+    d[4]=0.0;
+    d[5]=0.0;
+    for(size_t i=0; i<n; i++) {
+        if(i>0) {
+            if(x[i]<x[i-1]) {
+                // not sorted, search again
+                idx=find_interval(x[i]);
+            } else {
+                // walk forward to the closest point m_x[idx] < x
+                while(idx+1<nx && m_x[idx+1]<x[i]) idx++;
+            }
         }
+        eval_all(idx, x[i], d);
+        if(d0!=NULL) d0[i]=(order<=5) ? d[order] : 0.0;
+        if(d1!=NULL) d1[i]=(order+1<=5) ? d[order+1] : 0.0;
+        if(d2!=NULL) d2[i]=(order+2<=5) ? d[order+2] : 0.0;
+    }
+}
+
+void spline::get_state(std::vector<double>& state) const
+{
+    const size_t n=m_x.size();
+    state.resize(8+7*n);
+    state[0]=static_cast<double>(n);
+    state[1]=m_b0;
+    state[2]=m_c0;
+    state[3]=static_cast<double>(m_left);
+    state[4]=static_cast<double>(m_right);
+    state[5]=m_left_value;
+    state[6]=m_right_value;
+    state[7]=m_force_linear_extrapolation ? 1.0 : 0.0;
+    double* p=&state[8];
+    for(size_t i=0; i<n; i++) {
+        *(p++)=m_x[i];
+        *(p++)=m_y[i];
+        *(p++)=m_coef[i].x0;
+        *(p++)=m_coef[i].a;
+        *(p++)=m_coef[i].b;
+        *(p++)=m_coef[i].c;
+        *(p++)=m_coef[i].d;
+    }
+}
+
+void spline::set_state(const std::vector<double>& state)
+{
+    assert(state.size()>=8);
+    const size_t n=static_cast<size_t>(state[0]);
+    assert(state.size()==8+7*n);
+    m_b0=state[1];
+    m_c0=state[2];
+    m_left=static_cast<bd_type>(static_cast<int>(state[3]));
+    m_right=static_cast<bd_type>(static_cast<int>(state[4]));
+    m_left_value=state[5];
+    m_right_value=state[6];
+    m_force_linear_extrapolation=(state[7]!=0.0);
+    m_x.resize(n);
+    m_y.resize(n);
+    m_coef.resize(n);
+    const double* p=&state[8];
+    for(size_t i=0; i<n; i++) {
+        m_x[i]=*(p++);
+        m_y[i]=*(p++);
+        m_coef[i].x0=*(p++);
+        m_coef[i].a=*(p++);
+        m_coef[i].b=*(p++);
+        m_coef[i].c=*(p++);
+        m_coef[i].d=*(p++);
     }
-    return interpol;
 }
 
 void spline::write(const std::string& filename, const int& nsampling) const
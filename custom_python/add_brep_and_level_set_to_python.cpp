@@ -35,10 +35,15 @@
 #include "custom_algebra/level_set/intersection_level_set.h"
 #include "custom_algebra/level_set/difference_level_set.h"
 #include "custom_algebra/level_set/distance_to_curve_level_set.h"
+#include "custom_algebra/level_set/grid_level_set.h"
+#include "custom_algebra/level_set/triangle_mesh_level_set.h"
+#include "custom_algebra/level_set/nary_union_level_set.h"
+#include "custom_algebra/level_set/nary_intersection_level_set.h"
 #include "custom_algebra/curve/curve.h"
 #include "custom_algebra/curve/parametric_curve.h"
 #include "custom_algebra/surface/parametric_surface.h"
 #include "custom_algebra/volume/parametric_volume.h"
+#include "custom_python/python_array_helper.h"
 
 
 namespace Kratos
@@ -71,6 +76,152 @@ bool BRep_IsInside3(BRep& rDummy, const double& x, const double& y, const double
     return rDummy.IsInside(P);
 }
 
+/// Return [min, max] of the bounding box, or None if the BRep does not provide it
+object BRep_GetBoundingBox(BRep& rDummy)
+{
+    BRep::PointType Min, Max;
+    if(!rDummy.GetBoundingBox(Min, Max))
+        return object();
+
+    array_1d<double, 3> BoxMin, BoxMax;
+    for(std::size_t d = 0; d < 3; ++d)
+    {
+        BoxMin[d] = Min[d];
+        BoxMax[d] = Max[d];
+    }
+
+    boost::python::list Output;
+    Output.append(BoxMin);
+    Output.append(BoxMax);
+    return Output;
+}
+
+struct LevelSet_ValueOperation
+{
+    LevelSet_ValueOperation(const LevelSet& rLevelSet) : mrLevelSet(rLevelSet) {}
+
+    void operator()(const double* X, const std::size_t n, double* V) const
+    {
+        std::vector<LevelSet::PointType> Points(n);
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            Points[i][0] = X[3*i];
+            Points[i][1] = X[3*i + 1];
+            Points[i][2] = X[3*i + 2];
+        }
+        mrLevelSet.GetValues(&Points[0], n, V);
+    }
+
+    const LevelSet& mrLevelSet;
+};
+
+struct LevelSet_GradientOperation
+{
+    LevelSet_GradientOperation(const LevelSet& rLevelSet) : mrLevelSet(rLevelSet) {}
+
+    void operator()(const double* X, const std::size_t n, double* G) const
+    {
+        std::vector<LevelSet::PointType> Points(n);
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            Points[i][0] = X[3*i];
+            Points[i][1] = X[3*i + 1];
+            Points[i][2] = X[3*i + 2];
+        }
+        std::vector<array_1d<double, 3> > Gradients(n);
+        mrLevelSet.GetGradients(&Points[0], n, &Gradients[0]);
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            G[3*i] = Gradients[i][0];
+            G[3*i + 1] = Gradients[i][1];
+            G[3*i + 2] = Gradients[i][2];
+        }
+    }
+
+    const LevelSet& mrLevelSet;
+};
+
+void LevelSet_GetValues_1(LevelSet& rDummy, object points, object values)
+{
+    PythonArray_Evaluate<3, 1>(LevelSet_ValueOperation(rDummy), points, values);
+}
+
+object LevelSet_GetValues_2(LevelSet& rDummy, object points)
+{
+    object values = PythonArray_Create(PythonArrayBuffer(points, 3, false).size(), 1);
+    LevelSet_GetValues_1(rDummy, points, values);
+    return values;
+}
+
+void LevelSet_GetGradients_1(LevelSet& rDummy, object points, object gradients)
+{
+    PythonArray_Evaluate<3, 3>(LevelSet_GradientOperation(rDummy), points, gradients);
+}
+
+object LevelSet_GetGradients_2(LevelSet& rDummy, object points)
+{
+    object gradients = PythonArray_Create(PythonArrayBuffer(points, 3, false).size(), 3);
+    LevelSet_GetGradients_1(rDummy, points, gradients);
+    return gradients;
+}
+
+/// Create the level set from a list of vertices and a list of triangles, each given by 3 vertex indices
+TriangleMeshLevelSet::Pointer TriangleMeshLevelSet_init(boost::python::list vertex_list, boost::python::list triangle_list)
+{
+    std::vector<array_1d<double, 3> > Vertices(boost::python::len(vertex_list));
+    for (std::size_t i = 0; i < Vertices.size(); ++i)
+        Vertices[i] = boost::python::extract<array_1d<double, 3> >(vertex_list[i]);
+
+    std::vector<std::size_t> Triangles;
+    for (int i = 0; i < boost::python::len(triangle_list); ++i)
+    {
+        boost::python::object triangle = triangle_list[i];
+        if (boost::python::len(triangle) != 3)
+            KRATOS_THROW_ERROR(std::logic_error, "A triangle must have 3 vertices, triangle", i)
+        for (int k = 0; k < 3; ++k)
+            Triangles.push_back(static_cast<std::size_t>(boost::python::extract<int>(triangle[k])));
+    }
+
+    return TriangleMeshLevelSet::Pointer(new TriangleMeshLevelSet(Vertices, Triangles));
+}
+
+array_1d<double, 3> LevelSet_ProjectOnSurface(LevelSet& rDummy, const array_1d<double, 3>& rPoint)
+{
+    LevelSet::PointType P, Proj;
+    P[0] = rPoint[0];
+    P[1] = rPoint[1];
+    P[2] = rPoint[2];
+    rDummy.ProjectOnSurface(P, Proj);
+
+    array_1d<double, 3> Result;
+    Result[0] = Proj[0];
+    Result[1] = Proj[1];
+    Result[2] = Proj[2];
+    return Result;
+}
+
+/// Create the n-ary level set from a list of level sets
+template<class TNaryLevelSetType>
+typename TNaryLevelSetType::Pointer NaryLevelSet_init(boost::python::list level_set_list)
+{
+    std::vector<LevelSet::Pointer> pLevelSets(boost::python::len(level_set_list));
+    for (std::size_t i = 0; i < pLevelSets.size(); ++i)
+        pLevelSets[i] = boost::python::extract<LevelSet::Pointer>(level_set_list[i]);
+
+    return typename TNaryLevelSetType::Pointer(new TNaryLevelSetType(pLevelSets));
+}
+
+double LevelSet_GetLipschitzConstant(LevelSet& rDummy, const array_1d<double, 3>& rMin, const array_1d<double, 3>& rMax)
+{
+    LevelSet::PointType Min, Max;
+    for (std::size_t d = 0; d < 3; ++d)
+    {
+        Min[d] = rMin[d];
+        Max[d] = rMax[d];
+    }
+    return rDummy.GetLipschitzConstant(Min, Max);
+}
+
 LevelSet::Pointer InverseLevelSet_GetLevelSet(InverseLevelSet& rDummy)
 {
     return rDummy.pLeveSet();
@@ -174,6 +325,12 @@ boost::python::list Curve_ProjectOnCurve(Curve& rDummy, const Curve::PointType&
     return Output;
 }
 
+template<class TVariableType>
+void Curve_SetValue(Curve& rDummy, const TVariableType& rVariable, const typename TVariableType::Type& rValue)
+{
+    rDummy.SetValue(rVariable, rValue);
+}
+
 void BRepApplication_AddBRepAndLevelSetToPython()
 {
     /**************************************************************/
@@ -196,6 +353,7 @@ void BRepApplication_AddBRepAndLevelSetToPython()
     .def("CutStatus", pointer_to_CutStatusGeometry)
     .def("CutStatusBySampling", pointer_to_CutStatusBySamplingElement)
     .def("CutStatusBySampling", pointer_to_CutStatusBySamplingGeometry)
+    .def("GetBoundingBox", &BRep_GetBoundingBox)
     .def("Clone", &BRep::CloneBRep)
     .def_readonly("_CUT", &BRep::_CUT)
     .def_readonly("_IN", &BRep::_IN)
@@ -210,6 +368,12 @@ void BRepApplication_AddBRepAndLevelSetToPython()
     .def("ComputeDistance", pointer_to_ComputeDistance)
     .def("ComputeProjection", pointer_to_ComputeProjection)
     .def("ProjectOnCurve", Curve_ProjectOnCurve)
+    .def("Initialize", &Curve::Initialize)
+    .def("SetValue", &Curve_SetValue<Variable<bool> >)
+    .def("SetValue", &Curve_SetValue<Variable<int> >)
+    .def("SetValue", &Curve_SetValue<Variable<double> >)
+    .def("SetValue", &Curve_SetValue<Variable<array_1d<double, 3> > >)
+    .def("SetValue", &Curve_SetValue<Variable<Vector> >)
     ;
 
     class_<ParametricCurve, ParametricCurve::Pointer, boost::noncopyable, bases<Curve> >
@@ -234,6 +398,12 @@ void BRepApplication_AddBRepAndLevelSetToPython()
     class_<LevelSet, LevelSet::Pointer, boost::noncopyable, bases<FunctionR3R1, BRep> >
     ( "LevelSet", init<>() )
     .def("GetValue", LevelSet_pointer_to_GetValue)
+    .def("GetValues", LevelSet_GetValues_1)
+    .def("GetValues", LevelSet_GetValues_2)
+    .def("GetGradients", LevelSet_GetGradients_1)
+    .def("GetGradients", LevelSet_GetGradients_2)
+    .def("SetLipschitzConstant", &LevelSet::SetLipschitzConstant)
+    .def("GetLipschitzConstant", &LevelSet_GetLipschitzConstant)
     .def(self_ns::str(self))
     ;
 
@@ -262,6 +432,8 @@ void BRepApplication_AddBRepAndLevelSetToPython()
 
     class_<ConeLevelSet, ConeLevelSet::Pointer, boost::noncopyable, bases<LevelSet> >
     ( "ConeLevelSet", init<const double&, const double&, const double&, const double&, const double&, const double&, const double&>() )
+    .def("SetAxialRange", &ConeLevelSet::SetAxialRange)
+    .def("IsTruncated", &ConeLevelSet::IsTruncated)
     .def(self_ns::str(self))
     ;
 
@@ -310,6 +482,42 @@ void BRepApplication_AddBRepAndLevelSetToPython()
     .def(self_ns::str(self))
     ;
 
+    class_<GridLevelSet, GridLevelSet::Pointer, boost::noncopyable, bases<LevelSet> >
+    ( "GridLevelSet", init<const LevelSet::Pointer, const array_1d<double, 3>&, const array_1d<double, 3>&, const double&, const double&, const int&>() )
+    .def("NumberOfBricks", &GridLevelSet::NumberOfBricks)
+    .def("NumberOfAllocatedBricks", &GridLevelSet::NumberOfAllocatedBricks)
+    .def(self_ns::str(self))
+    ;
+
+    class_<TriangleMeshLevelSet, TriangleMeshLevelSet::Pointer, boost::noncopyable, bases<LevelSet> >
+    ( "TriangleMeshLevelSet", no_init )
+    .def("__init__", make_constructor(&TriangleMeshLevelSet_init))
+    .def("NumberOfVertices", &TriangleMeshLevelSet::NumberOfVertices)
+    .def("NumberOfTriangles", &TriangleMeshLevelSet::NumberOfTriangles)
+    .def("ProjectOnSurface", &LevelSet_ProjectOnSurface)
+    .def(self_ns::str(self))
+    ;
+
+    class_<NaryLevelSet, NaryLevelSet::Pointer, boost::noncopyable, bases<LevelSet> >
+    ( "NaryLevelSet", no_init )
+    .def("AddLevelSet", &NaryLevelSet::AddLevelSet)
+    .def("Initialize", &NaryLevelSet::Initialize)
+    .def("NumberOfLevelSets", &NaryLevelSet::NumberOfLevelSets)
+    .def("GetLevelSet", &NaryLevelSet::pGetLevelSet)
+    ;
+
+    class_<NaryUnionLevelSet, NaryUnionLevelSet::Pointer, boost::noncopyable, bases<NaryLevelSet> >
+    ( "NaryUnionLevelSet", init<>() )
+    .def("__init__", make_constructor(&NaryLevelSet_init<NaryUnionLevelSet>))
+    .def(self_ns::str(self))
+    ;
+
+    class_<NaryIntersectionLevelSet, NaryIntersectionLevelSet::Pointer, boost::noncopyable, bases<NaryLevelSet> >
+    ( "NaryIntersectionLevelSet", init<>() )
+    .def("__init__", make_constructor(&NaryLevelSet_init<NaryIntersectionLevelSet>))
+    .def(self_ns::str(self))
+    ;
+
     /**************************************************************/
     /************* EXPORT INTERFACE FOR PARTICULAR BREP ***********/
     /**************************************************************/
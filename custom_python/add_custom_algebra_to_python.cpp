@@ -15,6 +15,7 @@
 #include "custom_python/add_custom_algebra_to_python.h"
 #include "custom_algebra/function/function.h"
 #include "custom_algebra/function/heaviside_function.h"
+#include "custom_algebra/function/cached_heaviside_function.h"
 #include "custom_algebra/function/scalar_function.h"
 #include "custom_algebra/function/zero_function.h"
 #include "custom_algebra/function/monomial_function.h"
@@ -26,12 +27,16 @@
 #include "custom_algebra/function/negate_function.h"
 #include "custom_algebra/function/inverse_function.h"
 #include "custom_algebra/function/cubic_spline_function.h"
+#include "custom_algebra/function/compiled_function.h"
+#include "custom_algebra/function/polynomial_function.h"
+#include "custom_algebra/function/tabulated_function.h"
 #ifdef BREP_APPLICATION_USE_MASHPRESSO
 #include "custom_algebra/function/mathpresso_function.h"
 #endif
 #include "custom_algebra/function/load_function.h"
 #include "custom_algebra/function/load_function_plate_with_the_hole.h"
 #include "custom_algebra/function/hydrostatic_pressure_function_on_surface.h"
+#include "custom_python/python_array_helper.h"
 
 
 namespace Kratos
@@ -61,6 +66,75 @@ double Helper_FunctionR3R1_GetValue_2(FunctionR3R1& rDummy,
     return rDummy.GetValue(P);
 }
 
+struct FunctionR3R1_ValueOperation
+{
+    FunctionR3R1_ValueOperation(const FunctionR3R1& rFunction) : mrFunction(rFunction) {}
+
+    void operator()(const double* X, const std::size_t n, double* V) const
+    {
+        std::vector<FunctionR3R1::InputType> Points(n);
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            Points[i][0] = X[3*i];
+            Points[i][1] = X[3*i + 1];
+            Points[i][2] = X[3*i + 2];
+        }
+        mrFunction.GetValues(&Points[0], n, V);
+    }
+
+    const FunctionR3R1& mrFunction;
+};
+
+struct FunctionR3R1_GradientOperation
+{
+    FunctionR3R1_GradientOperation(const FunctionR3R1& rFunction) : mrFunction(rFunction) {}
+
+    void operator()(const double* X, const std::size_t n, double* G) const
+    {
+        std::vector<FunctionR3R1::InputType> Points(n);
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            Points[i][0] = X[3*i];
+            Points[i][1] = X[3*i + 1];
+            Points[i][2] = X[3*i + 2];
+        }
+        std::vector<FunctionR3R1::GradientType> Gradients(n);
+        mrFunction.GetGradients(&Points[0], n, &Gradients[0]);
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            G[3*i] = Gradients[i][0];
+            G[3*i + 1] = Gradients[i][1];
+            G[3*i + 2] = Gradients[i][2];
+        }
+    }
+
+    const FunctionR3R1& mrFunction;
+};
+
+void Helper_FunctionR3R1_GetValues_1(FunctionR3R1& rDummy, object points, object values)
+{
+    PythonArray_Evaluate<3, 1>(FunctionR3R1_ValueOperation(rDummy), points, values);
+}
+
+object Helper_FunctionR3R1_GetValues_2(FunctionR3R1& rDummy, object points)
+{
+    object values = PythonArray_Create(PythonArrayBuffer(points, 3, false).size(), 1);
+    Helper_FunctionR3R1_GetValues_1(rDummy, points, values);
+    return values;
+}
+
+void Helper_FunctionR3R1_GetGradients_1(FunctionR3R1& rDummy, object points, object gradients)
+{
+    PythonArray_Evaluate<3, 3>(FunctionR3R1_GradientOperation(rDummy), points, gradients);
+}
+
+object Helper_FunctionR3R1_GetGradients_2(FunctionR3R1& rDummy, object points)
+{
+    object gradients = PythonArray_Create(PythonArrayBuffer(points, 3, false).size(), 3);
+    Helper_FunctionR3R1_GetGradients_1(rDummy, points, gradients);
+    return gradients;
+}
+
 double Helper_FunctionR1R1_GetDerivative(FunctionR1R1& rDummy,
         const double& t)
 {
@@ -99,6 +173,24 @@ void CubicSplineFunction_SetPoints(CubicSplineFunction<TDerivDegree>& rDummy, bo
     rDummy.SetPoints(t, x);
 }
 
+template<class TFunction>
+void PolynomialFunction_AddTerm(PolynomialFunction<TFunction>& rDummy, const double& c,
+    boost::python::list list_exponents)
+{
+    std::vector<std::size_t> exponents;
+
+    typedef boost::python::stl_input_iterator<std::size_t> iterator_tree_type;
+
+    BOOST_FOREACH(const typename iterator_tree_type::value_type& v,
+                  std::make_pair(iterator_tree_type(list_exponents), // begin
+                  iterator_tree_type() ) ) // end
+    {
+        exponents.push_back(v);
+    }
+
+    rDummy.AddTerm(c, exponents);
+}
+
 void BRepApplication_AddFunctionsToPython()
 {
     /**************************************************************/
@@ -108,6 +200,7 @@ void BRepApplication_AddFunctionsToPython()
     double(FunctionR1R1::*FunctionR1R1_pointer_to_GetValue)(const double&) const = &FunctionR1R1::GetValue;
     double(FunctionR1R1::*FunctionR1R1_pointer_to_Integrate)(Element::Pointer&) const = &FunctionR1R1::Integrate;
     double(FunctionR1R1::*FunctionR1R1_pointer_to_Integrate2)(Element::Pointer&, const int) const = &FunctionR1R1::Integrate;
+    FunctionR1R1::Pointer(FunctionR1R1::*FunctionR1R1_pointer_to_Simplify)() const = &FunctionR1R1::Simplify;
 
     class_<FunctionR1R1, FunctionR1R1::Pointer, boost::noncopyable>
     ("FunctionR1R1", init<>())
@@ -118,6 +211,7 @@ void BRepApplication_AddFunctionsToPython()
     .def("GetSecondDerivative", Helper_FunctionR1R1_GetSecondDerivative)
     .def("GetFormula", &FunctionR1R1::GetFormula)
     .def("GetDiffFunction", &FunctionR1R1::GetDiffFunction)
+    .def("Simplify", FunctionR1R1_pointer_to_Simplify)
     .def(self_ns::str(self))
     ;
 
@@ -209,6 +303,27 @@ void BRepApplication_AddFunctionsToPython()
     .def("SetPoints", &CubicSplineFunction_SetPoints<1>)
     ;
 
+    typedef PolynomialFunction<FunctionR1R1> PolynomialFunctionR1R1;
+    class_<PolynomialFunctionR1R1, PolynomialFunctionR1R1::Pointer, boost::noncopyable, bases<FunctionR1R1> >
+    ("PolynomialFunctionR1R1", init<>())
+    .def("AddTerm", &PolynomialFunction_AddTerm<FunctionR1R1>)
+    .def("NumberOfTerms", &PolynomialFunctionR1R1::NumberOfTerms)
+    .def(self_ns::str(self))
+    ;
+
+    typedef CompiledFunction<FunctionR1R1> CompiledFunctionR1R1;
+    class_<CompiledFunctionR1R1, CompiledFunctionR1R1::Pointer, boost::noncopyable, bases<FunctionR1R1> >
+    ("CompiledFunctionR1R1", init<const FunctionR1R1::Pointer>())
+    ;
+
+    typedef TabulatedFunction<FunctionR1R1> TabulatedFunctionR1R1;
+    class_<TabulatedFunctionR1R1, TabulatedFunctionR1R1::Pointer, boost::noncopyable, bases<FunctionR1R1> >
+    ("TabulatedFunctionR1R1", init<const FunctionR1R1::Pointer, const double&, const double&, const std::size_t&>())
+    .def(init<const FunctionR1R1::Pointer, const double&, const double&, const std::size_t&, const double&>())
+    .def("NumberOfSamples", &TabulatedFunctionR1R1::NumberOfSamples)
+    .def(self_ns::str(self))
+    ;
+
     /**************************************************************/
     /************** EXPORT INTERFACE FOR FUNCTIONR1R3 *************/
     /**************************************************************/
@@ -228,6 +343,14 @@ void BRepApplication_AddFunctionsToPython()
     .def("GetDiffFunction", &FunctionR1R3::GetDiffFunction)
     ;
 
+    typedef TabulatedFunction<FunctionR1R3> TabulatedFunctionR1R3;
+    class_<TabulatedFunctionR1R3, TabulatedFunctionR1R3::Pointer, boost::noncopyable, bases<FunctionR1R3> >
+    ("TabulatedFunctionR1R3", init<const FunctionR1R3::Pointer, const double&, const double&, const std::size_t&>())
+    .def(init<const FunctionR1R3::Pointer, const double&, const double&, const std::size_t&, const double&>())
+    .def("NumberOfSamples", &TabulatedFunctionR1R3::NumberOfSamples)
+    .def(self_ns::str(self))
+    ;
+
     /**************************************************************/
     /************** EXPORT INTERFACE FOR FUNCTIONR2R1 *************/
     /**************************************************************/
@@ -235,6 +358,7 @@ void BRepApplication_AddFunctionsToPython()
     double(FunctionR2R1::*FunctionR2R1_pointer_to_GetValue)(const array_1d<double, 2>&) const = &FunctionR2R1::GetValue;
     double(FunctionR2R1::*FunctionR2R1_pointer_to_Integrate)(Element::Pointer&) const = &FunctionR2R1::Integrate;
     double(FunctionR2R1::*FunctionR2R1_pointer_to_Integrate2)(Element::Pointer&, const int) const = &FunctionR2R1::Integrate;
+    FunctionR2R1::Pointer(FunctionR2R1::*FunctionR2R1_pointer_to_Simplify)() const = &FunctionR2R1::Simplify;
 
     class_<FunctionR2R1, FunctionR2R1::Pointer, boost::noncopyable>
     ("FunctionR2R1", init<>())
@@ -243,6 +367,7 @@ void BRepApplication_AddFunctionsToPython()
     .def("GetValue", FunctionR2R1_pointer_to_GetValue)
     .def("GetFormula", &FunctionR2R1::GetFormula)
     .def("GetDiffFunction", &FunctionR2R1::GetDiffFunction)
+    .def("Simplify", FunctionR2R1_pointer_to_Simplify)
     ;
 
     typedef ProductFunction<FunctionR2R1> ProductFunctionR2R1;
@@ -283,6 +408,19 @@ void BRepApplication_AddFunctionsToPython()
     ("MonomialFunctionR2R1Y", init<>())
     ;
 
+    typedef PolynomialFunction<FunctionR2R1> PolynomialFunctionR2R1;
+    class_<PolynomialFunctionR2R1, PolynomialFunctionR2R1::Pointer, boost::noncopyable, bases<FunctionR2R1> >
+    ("PolynomialFunctionR2R1", init<>())
+    .def("AddTerm", &PolynomialFunction_AddTerm<FunctionR2R1>)
+    .def("NumberOfTerms", &PolynomialFunctionR2R1::NumberOfTerms)
+    .def(self_ns::str(self))
+    ;
+
+    typedef CompiledFunction<FunctionR2R1> CompiledFunctionR2R1;
+    class_<CompiledFunctionR2R1, CompiledFunctionR2R1::Pointer, boost::noncopyable, bases<FunctionR2R1> >
+    ("CompiledFunctionR2R1", init<const FunctionR2R1::Pointer>())
+    ;
+
     /**************************************************************/
     /************** EXPORT INTERFACE FOR FUNCTIONR2R3 *************/
     /**************************************************************/
@@ -307,20 +445,43 @@ void BRepApplication_AddFunctionsToPython()
     double(FunctionR3R1::*FunctionR3R1_pointer_to_GetValue)(const array_1d<double, 3>&) const = &FunctionR3R1::GetValue;
     double(FunctionR3R1::*FunctionR3R1_pointer_to_Integrate)(Element::Pointer&) const = &FunctionR3R1::Integrate;
     double(FunctionR3R1::*FunctionR3R1_pointer_to_Integrate2)(Element::Pointer&, const int) const = &FunctionR3R1::Integrate;
+    FunctionR3R1::Pointer(FunctionR3R1::*FunctionR3R1_pointer_to_Simplify)() const = &FunctionR3R1::Simplify;
+    double(FunctionR3R1::*FunctionR3R1_pointer_to_IntegrateOverModelPart)(ModelPart&, const int) const = &FunctionR3R1::IntegrateOverModelPart;
+    double(FunctionR3R1::*FunctionR3R1_pointer_to_IntegrateOverModelPart2)(ModelPart&, const int, const Variable<double>&) const = &FunctionR3R1::IntegrateOverModelPart;
+    double(FunctionR3R1::*FunctionR3R1_pointer_to_IntegrateOverModelPart3)(IntegrationPointsCache&, const int) const = &FunctionR3R1::IntegrateOverModelPart;
+    double(FunctionR3R1::*FunctionR3R1_pointer_to_IntegrateOverModelPart4)(IntegrationPointsCache&, const int, const Variable<double>&) const = &FunctionR3R1::IntegrateOverModelPart;
 
     class_<FunctionR3R1, FunctionR3R1::Pointer, boost::noncopyable>
     ("FunctionR3R1", init<>())
     .def("Integrate", FunctionR3R1_pointer_to_Integrate)
     .def("Integrate", FunctionR3R1_pointer_to_Integrate2)
+    .def("IntegrateOverModelPart", FunctionR3R1_pointer_to_IntegrateOverModelPart)
+    .def("IntegrateOverModelPart", FunctionR3R1_pointer_to_IntegrateOverModelPart2)
+    .def("IntegrateOverModelPart", FunctionR3R1_pointer_to_IntegrateOverModelPart3)
+    .def("IntegrateOverModelPart", FunctionR3R1_pointer_to_IntegrateOverModelPart4)
     .def("GetValue", FunctionR3R1_pointer_to_GetValue)
     .def("GetValue", Helper_FunctionR3R1_GetValue_1)
     .def("GetValue", Helper_FunctionR3R1_GetValue_2)
+    .def("GetValues", Helper_FunctionR3R1_GetValues_1)
+    .def("GetValues", Helper_FunctionR3R1_GetValues_2)
+    .def("GetGradients", Helper_FunctionR3R1_GetGradients_1)
+    .def("GetGradients", Helper_FunctionR3R1_GetGradients_2)
     .def("GetFormula", &FunctionR3R1::GetFormula)
     .def("GetDiffFunction", &FunctionR3R1::GetDiffFunction)
+    .def("Simplify", FunctionR3R1_pointer_to_Simplify)
     ;
 
+    Vector(FunctionR3Rn::*FunctionR3Rn_pointer_to_Integrate)(Element::Pointer&) const = &FunctionR3Rn::Integrate;
+    Vector(FunctionR3Rn::*FunctionR3Rn_pointer_to_Integrate2)(Element::Pointer&, const int) const = &FunctionR3Rn::Integrate;
+    Vector(FunctionR3Rn::*FunctionR3Rn_pointer_to_IntegrateOverModelPart)(ModelPart&, const int) const = &FunctionR3Rn::IntegrateOverModelPart;
+    Vector(FunctionR3Rn::*FunctionR3Rn_pointer_to_IntegrateOverModelPart2)(IntegrationPointsCache&, const int) const = &FunctionR3Rn::IntegrateOverModelPart;
+
     class_<FunctionR3Rn, FunctionR3Rn::Pointer, boost::noncopyable>
     ("FunctionR3Rn", init<>())
+    .def("Integrate", FunctionR3Rn_pointer_to_Integrate)
+    .def("Integrate", FunctionR3Rn_pointer_to_Integrate2)
+    .def("IntegrateOverModelPart", FunctionR3Rn_pointer_to_IntegrateOverModelPart)
+    .def("IntegrateOverModelPart", FunctionR3Rn_pointer_to_IntegrateOverModelPart2)
     ;
 
     class_<Variable<FunctionR3Rn::Pointer>, bases<VariableData>, boost::noncopyable>
@@ -336,6 +497,15 @@ void BRepApplication_AddFunctionsToPython()
     ("HeavisideFunctionR3R1", init<const BRep::Pointer>())
     ;
 
+    typedef CachedHeavisideFunction<FunctionR3R1> CachedHeavisideFunctionR3R1;
+    class_<CachedHeavisideFunctionR3R1, CachedHeavisideFunctionR3R1::Pointer, boost::noncopyable, bases<FunctionR3R1> >
+    ("CachedHeavisideFunctionR3R1", init<const BRep::Pointer, const double&>())
+    .def(init<const BRep::Pointer, const double&, const std::size_t&>())
+    .def("Clear", &CachedHeavisideFunctionR3R1::Clear)
+    .def("NumberOfCachedCells", &CachedHeavisideFunctionR3R1::NumberOfCachedCells)
+    .def(self_ns::str(self))
+    ;
+
     typedef ProductFunction<FunctionR3R1> ProductFunctionR3R1;
     class_<ProductFunctionR3R1, ProductFunctionR3R1::Pointer, boost::noncopyable, bases<FunctionR3R1> >
     ("ProductFunctionR3R1", init<const FunctionR3R1::Pointer, const FunctionR3R1::Pointer>())
@@ -1767,6 +1937,20 @@ void BRepApplication_AddFunctionsToPython()
     ;
     #endif
 
+    typedef PolynomialFunction<FunctionR3R1> PolynomialFunctionR3R1;
+    class_<PolynomialFunctionR3R1, PolynomialFunctionR3R1::Pointer, boost::noncopyable, bases<FunctionR3R1> >
+    ("PolynomialFunctionR3R1", init<>())
+    .def("AddTerm", &PolynomialFunction_AddTerm<FunctionR3R1>)
+    .def("NumberOfTerms", &PolynomialFunctionR3R1::NumberOfTerms)
+    .def(self_ns::str(self))
+    ;
+
+    typedef CompiledFunction<FunctionR3R1> CompiledFunctionR3R1;
+    class_<CompiledFunctionR3R1, CompiledFunctionR3R1::Pointer, boost::noncopyable, bases<FunctionR3R1> >
+    ("CompiledFunctionR3R1", init<const FunctionR3R1::Pointer>())
+    .def(self_ns::str(self))
+    ;
+
     /**************************************************************/
     /************* EXPORT INTERFACE FOR FUNCTIONR3R3 **************/
     /**************************************************************/
@@ -1774,11 +1958,15 @@ void BRepApplication_AddFunctionsToPython()
     array_1d<double, 3>(FunctionR3R3::*FunctionR3R3_pointer_to_GetValue)(const array_1d<double, 3>&) const = &FunctionR3R3::GetValue;
     array_1d<double, 3>(FunctionR3R3::*FunctionR3R3_pointer_to_Integrate)(Element::Pointer&) const = &FunctionR3R3::Integrate;
     array_1d<double, 3>(FunctionR3R3::*FunctionR3R3_pointer_to_Integrate2)(Element::Pointer&, const int) const = &FunctionR3R3::Integrate;
+    array_1d<double, 3>(FunctionR3R3::*FunctionR3R3_pointer_to_IntegrateOverModelPart)(ModelPart&, const int) const = &FunctionR3R3::IntegrateOverModelPart;
+    array_1d<double, 3>(FunctionR3R3::*FunctionR3R3_pointer_to_IntegrateOverModelPart2)(IntegrationPointsCache&, const int) const = &FunctionR3R3::IntegrateOverModelPart;
 
     class_<FunctionR3R3, FunctionR3R3::Pointer, boost::noncopyable>
     ("FunctionR3R3", init<>())
     .def("Integrate", FunctionR3R3_pointer_to_Integrate)
     .def("Integrate", FunctionR3R3_pointer_to_Integrate2)
+    .def("IntegrateOverModelPart", FunctionR3R3_pointer_to_IntegrateOverModelPart)
+    .def("IntegrateOverModelPart", FunctionR3R3_pointer_to_IntegrateOverModelPart2)
     .def("GetValue", FunctionR3R3_pointer_to_GetValue)
     .def("GetFormula", &FunctionR3R3::GetFormula)
     .def("GetDiffFunction", &FunctionR3R3::GetDiffFunction)
@@ -1791,6 +1979,12 @@ void BRepApplication_AddFunctionsToPython()
     .def(self_ns::str(self))
     ;
 
+    class_<LoadFunctionR3RN<3>, LoadFunctionR3RN<3>::Pointer, boost::noncopyable, bases<FunctionR3R3> >
+    ("LoadFunctionR3R3", init<>())
+    .def("SetComponent", &LoadFunctionR3RN<3>::SetComponent)
+    .def(self_ns::str(self))
+    ;
+
     class_<HydrostaticPressureFunctionOnSurface, HydrostaticPressureFunctionOnSurface::Pointer, boost::noncopyable, bases<FunctionR3R3> >
     ("HydrostaticPressureFunctionOnSurface", init<const double&, const double&, const array_1d<double, 3>&>())
     // .def(init<const double&, const double&, const Vector&>())
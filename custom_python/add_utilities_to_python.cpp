@@ -19,6 +19,9 @@
 #include "custom_utilities/brep_mesh_utility.h"
 #include "custom_utilities/delaunay.h"
 #include "custom_utilities/tube_mesher.h"
+#include "custom_utilities/integration_points_cache.h"
+#include "custom_algebra/function/function.h"
+#include "custom_algebra/level_set/level_set.h"
 
 namespace Kratos
 {
@@ -48,6 +51,21 @@ std::size_t BRepUtility_GetLastPropertiesId(BRepUtility& rDummy, ModelPart& r_mo
     return rDummy.GetLastPropertiesId(r_model_part);
 }
 
+template<class TFunctionType, class TPointType>
+std::size_t BRepUtility_CheckConcurrentEvaluation(BRepUtility& rDummy, const TFunctionType& rFunction,
+        boost::python::list point_list, const std::size_t nrepeat, const bool check_gradient)
+{
+    std::vector<TPointType> Points(boost::python::len(point_list));
+    for (std::size_t i = 0; i < Points.size(); ++i)
+    {
+        const array_1d<double, 3> P = boost::python::extract<array_1d<double, 3> >(point_list[i]);
+        Points[i][0] = P[0];
+        Points[i][1] = P[1];
+        Points[i][2] = P[2];
+    }
+    return rDummy.CheckConcurrentEvaluation(rFunction, Points, nrepeat, check_gradient);
+}
+
 boost::python::list BRepMeshUtility_CreateTriangleConditions(BRepMeshUtility& rDummy,
     ModelPart& r_model_part,
     const std::string& sample_condition_name,
@@ -193,6 +211,16 @@ public:
     }
 };
 
+void IntegrationPointsCache_Initialize(IntegrationPointsCache& rDummy, const int integration_order)
+{
+    rDummy.Initialize(FunctionR3R1::GetIntegrationMethod(integration_order));
+}
+
+void IntegrationPointsCache_Clear(IntegrationPointsCache& rDummy, const int integration_order)
+{
+    rDummy.Clear(FunctionR3R1::GetIntegrationMethod(integration_order));
+}
+
 void BRepApplication_AddUtilitiesToPython()
 {
 
@@ -213,6 +241,8 @@ void BRepApplication_AddUtilitiesToPython()
     .def("GetLastElementId", &BRepUtility_GetLastElementId)
     .def("GetLastConditionId", &BRepUtility_GetLastConditionId)
     .def("GetLastPropertiesId", &BRepUtility_GetLastPropertiesId)
+    .def("CheckConcurrentEvaluation", &BRepUtility_CheckConcurrentEvaluation<FunctionR3R1, FunctionR3R1::InputType>)
+    .def("CheckConcurrentEvaluation", &BRepUtility_CheckConcurrentEvaluation<LevelSet, LevelSet::PointType>)
     ;
 
     class_<BRepMeshUtility, BRepMeshUtility::Pointer, boost::noncopyable>
@@ -230,6 +260,15 @@ void BRepApplication_AddUtilitiesToPython()
     .def("GetSlices", &TubeMesher_GetSlices2)
     ;
 
+    void(IntegrationPointsCache::*IntegrationPointsCache_pointer_to_Clear)() = &IntegrationPointsCache::Clear;
+    class_<IntegrationPointsCache, IntegrationPointsCache::Pointer, boost::noncopyable>
+    ("IntegrationPointsCache", init<ModelPart&>())
+    .def("Initialize", &IntegrationPointsCache_Initialize)
+    .def("Clear", IntegrationPointsCache_pointer_to_Clear)
+    .def("Clear", &IntegrationPointsCache_Clear)
+    .def(self_ns::str(self))
+    ;
+
     void(Delaunay::*pointer_to_addPoint)(const double&, const double&) = &Delaunay::addPoint;
     class_<Delaunay, boost::shared_ptr<Delaunay>, boost::noncopyable>
     ("Delaunay", init<const double&, const double&, const double&, const double&>())
@@ -0,0 +1,197 @@
+// see brep_application/LICENSE.txt
+//
+//   Project Name:        Kratos
+//   Last Modified by:    $Author: hbui $
+//   Date:                $Date: 16 Oct 2026 $
+//   Revision:            $Revision: 1.0 $
+//
+//
+
+
+#if !defined(KRATOS_BREP_APPLICATION_PYTHON_ARRAY_HELPER_H_INCLUDED )
+#define  KRATOS_BREP_APPLICATION_PYTHON_ARRAY_HELPER_H_INCLUDED
+
+
+// System includes
+#include <string>
+#include <cstring>
+#include <sstream>
+#include <boost/python.hpp>
+
+
+// External includes
+
+
+// Project includes
+#include "includes/define.h"
+#include "utilities/openmp_utils.h"
+
+
+namespace Kratos
+{
+
+namespace Python
+{
+using namespace boost::python;
+
+/**
+ * Access to a C-contiguous array of float64 through the Python buffer protocol, e.g. a NumPy array.
+ * The array is either of shape (N, ncomponents) or a flat array of size N*ncomponents.
+ * The buffer is released on destruction.
+ */
+class PythonArrayBuffer
+{
+public:
+
+    PythonArrayBuffer(const object& rArray, const std::size_t ncomponents, const bool writable)
+    {
+        int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT;
+        if(writable)
+            flags |= PyBUF_WRITABLE;
+
+        if(PyObject_GetBuffer(rArray.ptr(), &mBuffer, flags) != 0)
+            throw_error_already_set();
+
+        const char* format = (mBuffer.format == NULL) ? "B" : mBuffer.format;
+        const std::size_t format_length = std::strlen(format);
+        bool is_double = (mBuffer.itemsize == sizeof(double)) && (format_length > 0) && (format[format_length-1] == 'd');
+        if(format_length == 2)
+            is_double = is_double && (format[0] == '<' || format[0] == '=' || format[0] == '@');
+        else if(format_length != 1)
+            is_double = false;
+
+        if(!is_double)
+        {
+            PyBuffer_Release(&mBuffer);
+            KRATOS_THROW_ERROR(std::logic_error, "The array must be of type float64, the buffer format is", format)
+        }
+
+        const std::size_t length = mBuffer.len / sizeof(double);
+        bool is_valid_shape;
+        if(mBuffer.ndim == 2)
+            is_valid_shape = (static_cast<std::size_t>(mBuffer.shape[1]) == ncomponents);
+        else if(mBuffer.ndim <= 1)
+            is_valid_shape = (length % ncomponents == 0);
+        else
+            is_valid_shape = false;
+
+        if(!is_valid_shape)
+        {
+            PyBuffer_Release(&mBuffer);
+            KRATOS_THROW_ERROR(std::logic_error, "The array must be of shape (N, n) or flat of size N*n, n =", ncomponents)
+        }
+
+        mSize = length / ncomponents;
+    }
+
+    ~PythonArrayBuffer()
+    {
+        PyBuffer_Release(&mBuffer);
+    }
+
+    /// Number of rows of the array
+    std::size_t size() const {return mSize;}
+
+    double* data() {return static_cast<double*>(mBuffer.buf);}
+
+private:
+
+    Py_buffer mBuffer;
+    std::size_t mSize;
+
+    PythonArrayBuffer(const PythonArrayBuffer& rOther);
+    PythonArrayBuffer& operator=(const PythonArrayBuffer& rOther);
+};
+
+
+/// Release the Python global interpreter lock within the scope
+class PythonAllowThreads
+{
+public:
+    PythonAllowThreads() : mpState(PyEval_SaveThread()) {}
+    ~PythonAllowThreads() {PyEval_RestoreThread(mpState);}
+private:
+    PyThreadState* mpState;
+};
+
+
+/// Create a NumPy float64 array of shape (nrows,) if ncolumns == 1 or (nrows, ncolumns) otherwise
+inline object PythonArray_Create(const std::size_t nrows, const std::size_t ncolumns)
+{
+    object numpy = import("numpy");
+    if(ncolumns == 1)
+        return numpy.attr("empty")(nrows);
+    return numpy.attr("empty")(make_tuple(nrows, ncolumns));
+}
+
+
+/**
+ * Evaluate rOperation(input, nrows, output) on the input array and write to the output array. The rows are divided in
+ * one contiguous chunk per thread and rOperation dispatches each chunk to the batched evaluation of the function.
+ * The loop runs in parallel with the global interpreter lock released, hence rOperation shall not touch any Python object.
+ * An exception raised by rOperation is re-thrown once the lock is acquired again.
+ */
+template<std::size_t TInputSize, std::size_t TOutputSize, class TOperationType>
+void PythonArray_Evaluate(const TOperationType& rOperation, const object& rInput, const object& rOutput)
+{
+    PythonArrayBuffer Input(rInput, TInputSize, false);
+    PythonArrayBuffer Output(rOutput, TOutputSize, true);
+
+    if(Input.size() != Output.size())
+    {
+        std::stringstream ss;
+        ss << "The number of rows of the input (" << Input.size() << ") and the output (" << Output.size() << ") arrays differ";
+        KRATOS_THROW_ERROR(std::logic_error, ss.str(), "")
+    }
+
+    const double* pInput = Input.data();
+    double* pOutput = Output.data();
+    const std::size_t nrows = Input.size();
+    if(nrows == 0)
+        return;
+
+    // small arrays are not worth to be divided
+    const int number_of_threads = (nrows < 256) ? 1 : OpenMPUtils::GetNumThreads();
+    OpenMPUtils::PartitionVector row_partition;
+    OpenMPUtils::DivideInPartitions(static_cast<int>(nrows), number_of_threads, row_partition);
+
+    bool error = false;
+    std::string error_message;
+
+    {
+        PythonAllowThreads allow_threads;
+
+        #pragma omp parallel for if(number_of_threads > 1)
+        for(int k = 0; k < number_of_threads; ++k)
+        {
+            const std::size_t begin = row_partition[k];
+            const std::size_t end = row_partition[k+1];
+            if(begin == end)
+                continue;
+
+            try
+            {
+                rOperation(pInput + begin*TInputSize, end - begin, pOutput + begin*TOutputSize);
+            }
+            catch(std::exception& e)
+            {
+                #pragma omp critical
+                {
+                    if(!error)
+                    {
+                        error = true;
+                        error_message = e.what();
+                    }
+                }
+            }
+        }
+    }
+
+    if(error)
+        KRATOS_THROW_ERROR(std::runtime_error, error_message, "")
+}
+
+}  // namespace Python.
+}  // namespace Kratos.
+
+#endif // KRATOS_BREP_APPLICATION_PYTHON_ARRAY_HELPER_H_INCLUDED  defined
@@ -36,6 +36,7 @@
 #include "includes/element.h"
 #include "includes/model_part.h"
 #include "includes/deprecated_variables.h"
+#include "utilities/openmp_utils.h"
 #include "containers/pointer_vector_set.h"
 #include "brep_application/custom_algebra/function/function.h"
 
@@ -179,6 +180,68 @@ public:
         return lastPropId;
     }
 
+    /// Check the concurrent evaluation of a function. The values (and the gradients if check_gradient is true) at the points
+    /// are computed serially, then all threads evaluate them again at the same time, nrepeat times, each thread starting at
+    /// a different point. Return the number of the concurrent evaluations differing from the serial ones.
+    /// TFunctionType is either FunctionR3R1 or LevelSet.
+    template<class TFunctionType, class TPointType>
+    static std::size_t CheckConcurrentEvaluation(const TFunctionType& rFunction,
+            const std::vector<TPointType>& rPoints, const std::size_t nrepeat, const bool check_gradient)
+    {
+        const std::size_t npoints = rPoints.size();
+        if(npoints == 0)
+            return 0;
+
+        std::vector<double> Values(npoints);
+        std::vector<FunctionR3R1::GradientType> Gradients(check_gradient ? npoints : 0);
+        for(std::size_t i = 0; i < npoints; ++i)
+        {
+            Values[i] = rFunction.GetValue(rPoints[i]);
+            if(check_gradient)
+                rFunction.GetGradient(rPoints[i], Gradients[i]);
+        }
+
+        const int number_of_threads = OpenMPUtils::GetNumThreads();
+        std::vector<std::size_t> NumberOfMismatches(number_of_threads, 0);
+
+        #pragma omp parallel for
+        for(int k = 0; k < number_of_threads; ++k)
+        {
+            std::size_t mismatches = 0;
+            for(std::size_t r = 0; r < nrepeat; ++r)
+            {
+                for(std::size_t j = 0; j < npoints; ++j)
+                {
+                    const std::size_t i = (j + k*npoints/number_of_threads) % npoints;
+
+                    if(rFunction.GetValue(rPoints[i]) != Values[i])
+                        ++mismatches;
+
+                    if(!check_gradient)
+                        continue;
+
+                    FunctionR3R1::GradientType Gradient;
+                    rFunction.GetGradient(rPoints[i], Gradient);
+                    for(std::size_t d = 0; d < 3; ++d)
+                    {
+                        if(Gradient[d] != Gradients[i][d])
+                        {
+                            ++mismatches;
+                            break;
+                        }
+                    }
+                }
+            }
+            NumberOfMismatches[k] = mismatches;
+        }
+
+        std::size_t Result = 0;
+        for(int k = 0; k < number_of_threads; ++k)
+            Result += NumberOfMismatches[k];
+
+        return Result;
+    }
+
     ///@}
     ///@name Access
     ///@{
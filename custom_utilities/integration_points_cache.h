@@ -0,0 +1,381 @@
+//    |  /           |
+//    ' /   __| _` | __|  _ \   __|
+//    . \  |   (   | |   (   |\__ `
+//   _|\_\_|  \__,_|\__|\___/ ____/
+//                   Multi-Physics
+//
+//  License:         brep_application/LICENSE.txt
+//                   Kratos default license: kratos/license.txt
+//
+//  Main authors:    Hoang-Giang Bui
+//  Date:            16 Oct 2026
+//
+
+
+#if !defined(KRATOS_INTEGRATION_POINTS_CACHE_H_INCLUDED )
+#define  KRATOS_INTEGRATION_POINTS_CACHE_H_INCLUDED
+
+
+
+// System includes
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+
+// External includes
+
+
+// Project includes
+#include "includes/define.h"
+#include "includes/element.h"
+#include "includes/model_part.h"
+#include "utilities/math_utils.h"
+#include "utilities/openmp_utils.h"
+
+
+namespace Kratos
+{
+///@addtogroup BRepApplication
+///@{
+
+///@name Kratos Globals
+///@{
+
+///@}
+///@name Type Definitions
+///@{
+
+///@}
+///@name  Enum's
+///@{
+
+///@}
+///@name  Functions
+///@{
+
+///@}
+///@name Kratos Classes
+///@{
+
+/// Short class definition.
+/** Cache of the global coordinates, determinant of Jacobian and weights at the integration points of the elements of a model part.
+ * The data of each integration method is stored in flat arrays, in the order of the elements in the model part; the range
+ * of an element is found from its position in the model part, or from its id. The cache is not updated automatically,
+ * i.e. Clear must be called when the nodes move.
+*/
+class IntegrationPointsCache
+{
+public:
+    ///@name Type Definitions
+    ///@{
+
+    /// Pointer definition of IntegrationPointsCache
+    KRATOS_CLASS_POINTER_DEFINITION(IntegrationPointsCache);
+
+    typedef Element::GeometryType GeometryType;
+
+    typedef array_1d<double, 3> PointType;
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// Default constructor.
+    IntegrationPointsCache(ModelPart& r_model_part) : mr_model_part(r_model_part)
+    {}
+
+    /// Destructor.
+    virtual ~IntegrationPointsCache()
+    {}
+
+
+    ///@}
+    ///@name Operators
+    ///@{
+
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+
+    /// Compute the data at the integration points of all the elements for an integration method. The elements are processed in parallel.
+    void Initialize(const GeometryData::IntegrationMethod ThisIntegrationMethod)
+    {
+        ModelPart::ElementsContainerType& rElements = mr_model_part.Elements();
+        const std::size_t number_of_elements = rElements.size();
+
+        MethodData& rData = mData[ThisIntegrationMethod];
+        rData.Ids.resize(number_of_elements);
+        rData.Offsets.resize(number_of_elements + 1);
+        rData.IsSorted = true;
+
+        rData.Offsets[0] = 0;
+        std::size_t i = 0;
+        for(ModelPart::ElementsContainerType::iterator it = rElements.begin(); it != rElements.end(); ++it, ++i)
+        {
+            rData.Ids[i] = it->Id();
+            rData.Offsets[i+1] = rData.Offsets[i] + it->GetGeometry().IntegrationPoints(ThisIntegrationMethod).size();
+            if((i > 0) && (rData.Ids[i] <= rData.Ids[i-1]))
+                rData.IsSorted = false;
+        }
+
+        const std::size_t number_of_points = rData.Offsets[number_of_elements];
+        rData.Points.resize(number_of_points);
+        rData.DetJ.resize(number_of_points);
+        rData.Weights.resize(number_of_points);
+
+        const int number_of_threads = OpenMPUtils::GetNumThreads();
+        OpenMPUtils::PartitionVector element_partition;
+        OpenMPUtils::DivideInPartitions(number_of_elements, number_of_threads, element_partition);
+
+        #pragma omp parallel for
+        for(int k = 0; k < number_of_threads; ++k)
+        {
+            Matrix J, JtJ;
+            for(int e = element_partition[k]; e < element_partition[k+1]; ++e)
+            {
+                const std::size_t offset = rData.Offsets[e];
+                ComputeGeometryData((rElements.begin() + e)->GetGeometry(), ThisIntegrationMethod,
+                        &rData.Points[offset], &rData.DetJ[offset], &rData.Weights[offset], J, JtJ);
+            }
+        }
+    }
+
+
+    /// Clear the data of all integration methods. This must be called when the nodes move.
+    void Clear()
+    {
+        mData.clear();
+    }
+
+
+    /// Clear the data of an integration method
+    void Clear(const GeometryData::IntegrationMethod ThisIntegrationMethod)
+    {
+        mData.erase(ThisIntegrationMethod);
+    }
+
+
+    /// Compute the global coordinates, determinant of Jacobian and weights at the integration points of a geometry.
+    /// The output arrays must hold the number of integration points of the geometry. J and JtJ are the working matrices.
+    static void ComputeGeometryData(GeometryType& r_geom, const GeometryData::IntegrationMethod ThisIntegrationMethod,
+            PointType* Points, double* DetJ, double* Weights, Matrix& J, Matrix& JtJ)
+    {
+        const GeometryType::IntegrationPointsArrayType& integration_points
+                = r_geom.IntegrationPoints( ThisIntegrationMethod );
+
+        const bool is_full_dimension = (r_geom.WorkingSpaceDimension() == r_geom.LocalSpaceDimension());
+
+        for(std::size_t point = 0; point < integration_points.size(); ++point)
+        {
+            r_geom.GlobalCoordinates(Points[point], integration_points[point]);
+
+            J = r_geom.Jacobian( J, integration_points[point] );
+            if(is_full_dimension)
+            {
+                DetJ[point] = MathUtils<double>::Det(J);
+            }
+            else
+            {
+                if(JtJ.size1() != J.size2() || JtJ.size2() != J.size2())
+                    JtJ.resize(J.size2(), J.size2(), false);
+                noalias(JtJ) = prod(trans(J), J);
+                DetJ[point] = sqrt(MathUtils<double>::Det(JtJ));
+            }
+
+            Weights[point] = integration_points[point].Weight();
+        }
+    }
+
+
+    ///@}
+    ///@name Access
+    ///@{
+
+
+    /// Get the data at the integration points of an element. Return false if the element is not in the cache.
+    bool GetIntegrationPoints(const std::size_t& ElementId, const GeometryData::IntegrationMethod ThisIntegrationMethod,
+            const PointType*& Points, const double*& DetJ, const double*& Weights, std::size_t& NumberOfPoints) const
+    {
+        std::map<int, MethodData>::const_iterator it_data = mData.find(ThisIntegrationMethod);
+        if(it_data == mData.end())
+            return false;
+
+        const MethodData& rData = it_data->second;
+
+        std::size_t i;
+        if(rData.IsSorted)
+        {
+            std::vector<std::size_t>::const_iterator it = std::lower_bound(rData.Ids.begin(), rData.Ids.end(), ElementId);
+            if((it == rData.Ids.end()) || (*it != ElementId))
+                return false;
+            i = it - rData.Ids.begin();
+        }
+        else
+        {
+            std::vector<std::size_t>::const_iterator it = std::find(rData.Ids.begin(), rData.Ids.end(), ElementId);
+            if(it == rData.Ids.end())
+                return false;
+            i = it - rData.Ids.begin();
+        }
+
+        GetData(rData, i, Points, DetJ, Weights, NumberOfPoints);
+        return true;
+    }
+
+
+    /// Get the data at the integration points of the element at the given position in the model part, without searching.
+    /// Return false if the element at that position in the cache does not have the given id, e.g. the elements have changed.
+    bool GetIntegrationPointsAt(const std::size_t& Position, const std::size_t& ElementId,
+            const GeometryData::IntegrationMethod ThisIntegrationMethod,
+            const PointType*& Points, const double*& DetJ, const double*& Weights, std::size_t& NumberOfPoints) const
+    {
+        std::map<int, MethodData>::const_iterator it_data = mData.find(ThisIntegrationMethod);
+        if(it_data == mData.end())
+            return false;
+
+        const MethodData& rData = it_data->second;
+        if((Position >= rData.Ids.size()) || (rData.Ids[Position] != ElementId))
+            return false;
+
+        GetData(rData, Position, Points, DetJ, Weights, NumberOfPoints);
+        return true;
+    }
+
+
+    ModelPart& GetModelPart() const
+    {
+        return mr_model_part;
+    }
+
+
+    ///@}
+    ///@name Inquiry
+    ///@{
+
+
+    /// Check if the data of an integration method is available
+    bool Has(const GeometryData::IntegrationMethod ThisIntegrationMethod) const
+    {
+        return mData.find(ThisIntegrationMethod) != mData.end();
+    }
+
+
+    ///@}
+    ///@name Input and output
+    ///@{
+
+    /// Turn back information as a string.
+    virtual std::string Info() const
+    {
+        return "IntegrationPointsCache";
+    }
+
+    /// Print information about this object.
+    virtual void PrintInfo(std::ostream& rOStream) const
+    {
+        rOStream << Info();
+    }
+
+    /// Print object's data.
+    virtual void PrintData(std::ostream& rOStream) const
+    {
+        for(std::map<int, MethodData>::const_iterator it = mData.begin(); it != mData.end(); ++it)
+        {
+            rOStream << " Integration method " << it->first << ": " << it->second.Ids.size() << " elements, "
+                     << it->second.Points.size() << " integration points" << std::endl;
+        }
+    }
+
+
+    ///@}
+    ///@name Friends
+    ///@{
+
+
+    ///@}
+
+private:
+    ///@name Static Member Variables
+    ///@{
+
+
+    ///@}
+    ///@name Member Variables
+    ///@{
+
+    /// Data of an integration method. The integration points of element i are in [Offsets[i], Offsets[i+1]).
+    struct MethodData
+    {
+        std::vector<std::size_t> Ids;
+        std::vector<std::size_t> Offsets;
+        std::vector<PointType> Points;
+        std::vector<double> DetJ;
+        std::vector<double> Weights;
+        bool IsSorted;
+    };
+
+    ModelPart& mr_model_part;
+    std::map<int, MethodData> mData;
+
+    ///@}
+    ///@name Private Operations
+    ///@{
+
+    static void GetData(const MethodData& rData, const std::size_t& i,
+            const PointType*& Points, const double*& DetJ, const double*& Weights, std::size_t& NumberOfPoints)
+    {
+        const std::size_t offset = rData.Offsets[i];
+        NumberOfPoints = rData.Offsets[i+1] - offset;
+        if(NumberOfPoints != 0)
+        {
+            Points = &rData.Points[offset];
+            DetJ = &rData.DetJ[offset];
+            Weights = &rData.Weights[offset];
+        }
+    }
+
+    ///@}
+    ///@name Un accessible methods
+    ///@{
+
+    /// Assignment operator.
+    IntegrationPointsCache& operator=(IntegrationPointsCache const& rOther);
+
+    /// Copy constructor.
+    IntegrationPointsCache(IntegrationPointsCache const& rOther);
+
+    ///@}
+
+}; // Class IntegrationPointsCache
+
+///@}
+
+///@name Type Definitions
+///@{
+
+
+///@}
+///@name Input and output
+///@{
+
+
+/// output stream function
+inline std::ostream& operator << (std::ostream& rOStream, const IntegrationPointsCache& rThis)
+{
+    rThis.PrintInfo(rOStream);
+    rOStream << std::endl;
+    rThis.PrintData(rOStream);
+
+    return rOStream;
+}
+///@}
+
+///@} addtogroup block
+
+}  // namespace Kratos.
+
+#endif // KRATOS_INTEGRATION_POINTS_CACHE_H_INCLUDED  defined
@@ -0,0 +1,576 @@
+//    |  /           |
+//    ' /   __| _` | __|  _ \   __|
+//    . \  |   (   | |   (   |\__ `
+//   _|\_\_|  \__,_|\__|\___/ ____/
+//                   Multi-Physics
+//
+//  License:         brep_application/LICENSE.txt
+//                   Kratos default license: kratos/license.txt
+//
+//  Main authors:    Hoang-Giang Bui
+//  Date:            16 Oct 2026
+//
+
+
+#if !defined(KRATOS_SYMBOLIC_EXPRESSION_H_INCLUDED )
+#define  KRATOS_SYMBOLIC_EXPRESSION_H_INCLUDED
+
+
+
+// System includes
+#include <cmath>
+#include <cctype>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <iostream>
+
+
+// External includes
+
+
+// Project includes
+#include "includes/define.h"
+
+
+namespace Kratos
+{
+///@addtogroup BRepApplication
+///@{
+
+///@name Kratos Globals
+///@{
+
+///@}
+///@name Type Definitions
+///@{
+
+///@}
+///@name  Enum's
+///@{
+
+///@}
+///@name  Functions
+///@{
+
+///@}
+///@name Kratos Classes
+///@{
+
+/// Short class definition.
+/** Immutable tree of an arithmetic expression, e.g. "sin(x)*pow(y, 2) + 3*z", which can be differentiated symbolically
+ * and printed back to a string. The accepted syntax is the arithmetic subset of MathPresso: numbers, identifiers,
+ * + - * /, parentheses and function calls. The identifiers which are not the differentiation variable are treated as
+ * constants. The sub-expressions are shared between an expression and its derivatives.
+*/
+class SymbolicExpression
+{
+public:
+    ///@name Type Definitions
+    ///@{
+
+    /// Pointer definition of SymbolicExpression
+    KRATOS_CLASS_POINTER_DEFINITION(SymbolicExpression);
+
+    enum ExpressionType
+    {
+        NUMBER,
+        IDENTIFIER,
+        NEGATE,
+        ADD,
+        SUBTRACT,
+        MULTIPLY,
+        DIVIDE,
+        FUNCTION
+    };
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// Constructor.
+    SymbolicExpression(const ExpressionType& Type, const double& Value, const std::string& Name,
+            const std::vector<SymbolicExpression::Pointer>& Args)
+    : mType(Type), mValue(Value), mName(Name), mArgs(Args)
+    {}
+
+    /// Destructor.
+    virtual ~SymbolicExpression() {}
+
+
+    ///@}
+    ///@name Operators
+    ///@{
+
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+
+    /// Parse an expression string
+    static SymbolicExpression::Pointer Parse(const std::string& expression)
+    {
+        std::size_t pos = 0;
+        SymbolicExpression::Pointer pExpr = ParseSum(expression, pos);
+        SkipSpaces(expression, pos);
+        if(pos != expression.size())
+            KRATOS_THROW_ERROR(std::logic_error, "Unexpected character in expression at position", pos)
+        return pExpr;
+    }
+
+
+    /// Create a number
+    static SymbolicExpression::Pointer Number(const double& value)
+    {
+        return SymbolicExpression::Pointer(new SymbolicExpression(NUMBER, value, "", std::vector<SymbolicExpression::Pointer>()));
+    }
+
+
+    /// Create an identifier, i.e. a variable or a named constant
+    static SymbolicExpression::Pointer Identifier(const std::string& name)
+    {
+        return SymbolicExpression::Pointer(new SymbolicExpression(IDENTIFIER, 0.0, name, std::vector<SymbolicExpression::Pointer>()));
+    }
+
+
+    /// Create the negation of an expression, with folding of numbers and double negation
+    static SymbolicExpression::Pointer Negate(const SymbolicExpression::Pointer& a)
+    {
+        if(a->IsNumber())
+            return Number(-a->mValue);
+        if(a->mType == NEGATE)
+            return a->mArgs[0];
+        std::vector<SymbolicExpression::Pointer> Args(1, a);
+        return SymbolicExpression::Pointer(new SymbolicExpression(NEGATE, 0.0, "", Args));
+    }
+
+
+    /// Create a binary operation, with folding of numbers and elimination of zeros and ones
+    static SymbolicExpression::Pointer Binary(const ExpressionType& Type, const SymbolicExpression::Pointer& a,
+            const SymbolicExpression::Pointer& b)
+    {
+        if(a->IsNumber() && b->IsNumber())
+        {
+            if(Type == ADD) return Number(a->mValue + b->mValue);
+            if(Type == SUBTRACT) return Number(a->mValue - b->mValue);
+            if(Type == MULTIPLY) return Number(a->mValue * b->mValue);
+            if(Type == DIVIDE) return Number(a->mValue / b->mValue);
+        }
+
+        if(Type == ADD)
+        {
+            if(a->IsNumber(0.0)) return b;
+            if(b->IsNumber(0.0)) return a;
+        }
+        else if(Type == SUBTRACT)
+        {
+            if(b->IsNumber(0.0)) return a;
+            if(a->IsNumber(0.0)) return Negate(b);
+        }
+        else if(Type == MULTIPLY)
+        {
+            if(a->IsNumber(0.0) || b->IsNumber(0.0)) return Number(0.0);
+            if(a->IsNumber(1.0)) return b;
+            if(b->IsNumber(1.0)) return a;
+            if(a->IsNumber(-1.0)) return Negate(b);
+            if(b->IsNumber(-1.0)) return Negate(a);
+        }
+        else if(Type == DIVIDE)
+        {
+            if(a->IsNumber(0.0)) return Number(0.0);
+            if(b->IsNumber(1.0)) return a;
+        }
+
+        std::vector<SymbolicExpression::Pointer> Args(2);
+        Args[0] = a;
+        Args[1] = b;
+        return SymbolicExpression::Pointer(new SymbolicExpression(Type, 0.0, "", Args));
+    }
+
+
+    /// Create a function call
+    static SymbolicExpression::Pointer Function(const std::string& name, const std::vector<SymbolicExpression::Pointer>& Args)
+    {
+        return SymbolicExpression::Pointer(new SymbolicExpression(FUNCTION, 0.0, name, Args));
+    }
+
+
+    static SymbolicExpression::Pointer Function(const std::string& name, const SymbolicExpression::Pointer& a)
+    {
+        return Function(name, std::vector<SymbolicExpression::Pointer>(1, a));
+    }
+
+
+    /// Check if the expression depends on an identifier
+    bool DependsOn(const std::string& variable) const
+    {
+        if(mType == IDENTIFIER)
+            return mName == variable;
+        for(std::size_t i = 0; i < mArgs.size(); ++i)
+            if(mArgs[i]->DependsOn(variable))
+                return true;
+        return false;
+    }
+
+
+    /// Compute the derivative of the expression w.r.t a variable
+    SymbolicExpression::Pointer Differentiate(const std::string& variable) const
+    {
+        if(!this->DependsOn(variable))
+            return Number(0.0);
+
+        switch(mType)
+        {
+        case IDENTIFIER:
+            return Number(1.0);
+        case NEGATE:
+            return Negate(mArgs[0]->Differentiate(variable));
+        case ADD:
+        case SUBTRACT:
+            return Binary(mType, mArgs[0]->Differentiate(variable), mArgs[1]->Differentiate(variable));
+        case MULTIPLY:
+            return Binary(ADD,
+                    Binary(MULTIPLY, mArgs[0]->Differentiate(variable), mArgs[1]),
+                    Binary(MULTIPLY, mArgs[0], mArgs[1]->Differentiate(variable)));
+        case DIVIDE:
+            // (a/b)' = a'/b - a*b'/b^2
+            return Binary(SUBTRACT,
+                    Binary(DIVIDE, mArgs[0]->Differentiate(variable), mArgs[1]),
+                    Binary(DIVIDE, Binary(MULTIPLY, mArgs[0], mArgs[1]->Differentiate(variable)),
+                        Binary(MULTIPLY, mArgs[1], mArgs[1])));
+        case FUNCTION:
+            return DifferentiateFunction(variable);
+        default:
+            return Number(0.0);
+        }
+    }
+
+
+    /// Print the expression in the MathPresso syntax
+    std::string ToString() const
+    {
+        std::stringstream ss;
+        ss.precision(17);
+        switch(mType)
+        {
+        case NUMBER:
+            if(mValue < 0.0)
+                ss << "(" << mValue << ")";
+            else
+                ss << mValue;
+            break;
+        case IDENTIFIER:
+            ss << mName;
+            break;
+        case NEGATE:
+            ss << "(-" << mArgs[0]->ToString() << ")";
+            break;
+        case ADD:
+            ss << "(" << mArgs[0]->ToString() << "+" << mArgs[1]->ToString() << ")";
+            break;
+        case SUBTRACT:
+            ss << "(" << mArgs[0]->ToString() << "-" << mArgs[1]->ToString() << ")";
+            break;
+        case MULTIPLY:
+            ss << mArgs[0]->ToString() << "*" << mArgs[1]->ToString();
+            break;
+        case DIVIDE:
+            ss << mArgs[0]->ToString() << "/(" << mArgs[1]->ToString() << ")";
+            break;
+        case FUNCTION:
+            ss << mName << "(";
+            for(std::size_t i = 0; i < mArgs.size(); ++i)
+            {
+                if(i != 0) ss << ",";
+                ss << mArgs[i]->ToString();
+            }
+            ss << ")";
+            break;
+        }
+        return ss.str();
+    }
+
+
+    ///@}
+    ///@name Access
+    ///@{
+
+
+    ///@}
+    ///@name Inquiry
+    ///@{
+
+
+    bool IsNumber() const
+    {
+        return mType == NUMBER;
+    }
+
+
+    bool IsNumber(const double& value) const
+    {
+        return (mType == NUMBER) && (mValue == value);
+    }
+
+
+    ///@}
+    ///@name Input and output
+    ///@{
+
+    /// Turn back information as a string.
+    virtual std::string Info() const
+    {
+        return "SymbolicExpression";
+    }
+
+    /// Print information about this object.
+    virtual void PrintInfo(std::ostream& rOStream) const
+    {
+        rOStream << Info();
+    }
+
+    /// Print object's data.
+    virtual void PrintData(std::ostream& rOStream) const
+    {
+        rOStream << ToString();
+    }
+
+
+    ///@}
+
+private:
+    ///@name Member Variables
+    ///@{
+
+    ExpressionType mType;
+    double mValue; // value of a number
+    std::string mName; // name of an identifier or function
+    std::vector<SymbolicExpression::Pointer> mArgs; // operands
+
+    ///@}
+    ///@name Private Operations
+    ///@{
+
+
+    /// Differentiate a function call by the chain rule
+    SymbolicExpression::Pointer DifferentiateFunction(const std::string& variable) const
+    {
+        if(mName == "pow" && mArgs.size() == 2)
+        {
+            const SymbolicExpression::Pointer& a = mArgs[0];
+            const SymbolicExpression::Pointer& b = mArgs[1];
+            if(!b->DependsOn(variable))
+            {
+                // (a^b)' = b*a^(b-1)*a'
+                std::vector<SymbolicExpression::Pointer> Args(2);
+                Args[0] = a;
+                Args[1] = Binary(SUBTRACT, b, Number(1.0));
+                SymbolicExpression::Pointer pPow = Args[1]->IsNumber(1.0) ? a : Function("pow", Args);
+                return Binary(MULTIPLY, Binary(MULTIPLY, b, pPow), a->Differentiate(variable));
+            }
+            // (a^b)' = a^b*(b'*log(a) + b*a'/a)
+            return Binary(MULTIPLY, Function("pow", mArgs),
+                    Binary(ADD, Binary(MULTIPLY, b->Differentiate(variable), Function("log", a)),
+                        Binary(DIVIDE, Binary(MULTIPLY, b, a->Differentiate(variable)), a)));
+        }
+
+        if(mArgs.size() != 1)
+            KRATOS_THROW_ERROR(std::logic_error, "Differentiation is not supported for function", mName)
+
+        const SymbolicExpression::Pointer& u = mArgs[0];
+        SymbolicExpression::Pointer df;
+        if(mName == "sin")
+            df = Function("cos", u);
+        else if(mName == "cos")
+            df = Negate(Function("sin", u));
+        else if(mName == "tan")
+            df = Binary(DIVIDE, Number(1.0), Binary(MULTIPLY, Function("cos", u), Function("cos", u)));
+        else if(mName == "asin")
+            df = Binary(DIVIDE, Number(1.0), Function("sqrt", Binary(SUBTRACT, Number(1.0), Binary(MULTIPLY, u, u))));
+        else if(mName == "acos")
+            df = Binary(DIVIDE, Number(-1.0), Function("sqrt", Binary(SUBTRACT, Number(1.0), Binary(MULTIPLY, u, u))));
+        else if(mName == "atan")
+            df = Binary(DIVIDE, Number(1.0), Binary(ADD, Number(1.0), Binary(MULTIPLY, u, u)));
+        else if(mName == "sinh")
+            df = Function("cosh", u);
+        else if(mName == "cosh")
+            df = Function("sinh", u);
+        else if(mName == "tanh")
+            df = Binary(SUBTRACT, Number(1.0), Binary(MULTIPLY, Function("tanh", u), Function("tanh", u)));
+        else if(mName == "exp")
+            df = Function("exp", u);
+        else if(mName == "log")
+            df = Binary(DIVIDE, Number(1.0), u);
+        else if(mName == "log10")
+            df = Binary(DIVIDE, Number(1.0/std::log(10.0)), u);
+        else if(mName == "sqrt")
+            df = Binary(DIVIDE, Number(0.5), Function("sqrt", u));
+        else if(mName == "abs")
+            df = Binary(DIVIDE, u, Function("abs", u));
+        else
+            KRATOS_THROW_ERROR(std::logic_error, "Differentiation is not supported for function", mName)
+
+        return Binary(MULTIPLY, df, u->Differentiate(variable));
+    }
+
+
+    static void SkipSpaces(const std::string& s, std::size_t& pos)
+    {
+        while(pos < s.size() && std::isspace(s[pos]))
+            ++pos;
+    }
+
+
+    /// sum := product (('+'|'-') product)*
+    static SymbolicExpression::Pointer ParseSum(const std::string& s, std::size_t& pos)
+    {
+        SymbolicExpression::Pointer pExpr = ParseProduct(s, pos);
+        while(true)
+        {
+            SkipSpaces(s, pos);
+            if(pos < s.size() && (s[pos] == '+' || s[pos] == '-'))
+            {
+                const ExpressionType Type = (s[pos] == '+') ? ADD : SUBTRACT;
+                ++pos;
+                pExpr = Binary(Type, pExpr, ParseProduct(s, pos));
+            }
+            else
+                return pExpr;
+        }
+    }
+
+
+    /// product := unary (('*'|'/') unary)*
+    static SymbolicExpression::Pointer ParseProduct(const std::string& s, std::size_t& pos)
+    {
+        SymbolicExpression::Pointer pExpr = ParseUnary(s, pos);
+        while(true)
+        {
+            SkipSpaces(s, pos);
+            if(pos < s.size() && (s[pos] == '*' || s[pos] == '/'))
+            {
+                const ExpressionType Type = (s[pos] == '*') ? MULTIPLY : DIVIDE;
+                ++pos;
+                pExpr = Binary(Type, pExpr, ParseUnary(s, pos));
+            }
+            else
+                return pExpr;
+        }
+    }
+
+
+    /// unary := ('-'|'+') unary | primary
+    static SymbolicExpression::Pointer ParseUnary(const std::string& s, std::size_t& pos)
+    {
+        SkipSpaces(s, pos);
+        if(pos < s.size() && s[pos] == '-')
+        {
+            ++pos;
+            return Negate(ParseUnary(s, pos));
+        }
+        if(pos < s.size() && s[pos] == '+')
+        {
+            ++pos;
+            return ParseUnary(s, pos);
+        }
+        return ParsePrimary(s, pos);
+    }
+
+
+    /// primary := number | identifier | identifier '(' sum (',' sum)* ')' | '(' sum ')'
+    static SymbolicExpression::Pointer ParsePrimary(const std::string& s, std::size_t& pos)
+    {
+        SkipSpaces(s, pos);
+        if(pos >= s.size())
+            KRATOS_THROW_ERROR(std::logic_error, "Unexpected end of expression", s)
+
+        if(s[pos] == '(')
+        {
+            ++pos;
+            SymbolicExpression::Pointer pExpr = ParseSum(s, pos);
+            Expect(s, pos, ')');
+            return pExpr;
+        }
+
+        if(std::isdigit(s[pos]) || s[pos] == '.')
+        {
+            const char* begin = s.c_str() + pos;
+            char* end;
+            const double value = std::strtod(begin, &end);
+            pos += end - begin;
+            return Number(value);
+        }
+
+        if(std::isalpha(s[pos]) || s[pos] == '_')
+        {
+            std::size_t begin = pos;
+            while(pos < s.size() && (std::isalnum(s[pos]) || s[pos] == '_'))
+                ++pos;
+            const std::string name = s.substr(begin, pos - begin);
+
+            SkipSpaces(s, pos);
+            if(pos < s.size() && s[pos] == '(')
+            {
+                ++pos;
+                std::vector<SymbolicExpression::Pointer> Args;
+                Args.push_back(ParseSum(s, pos));
+                SkipSpaces(s, pos);
+                while(pos < s.size() && s[pos] == ',')
+                {
+                    ++pos;
+                    Args.push_back(ParseSum(s, pos));
+                    SkipSpaces(s, pos);
+                }
+                Expect(s, pos, ')');
+                return Function(name, Args);
+            }
+
+            return Identifier(name);
+        }
+
+        KRATOS_THROW_ERROR(std::logic_error, "Unsupported character in expression at position", pos)
+    }
+
+
+    static void Expect(const std::string& s, std::size_t& pos, const char c)
+    {
+        SkipSpaces(s, pos);
+        if(pos >= s.size() || s[pos] != c)
+            KRATOS_THROW_ERROR(std::logic_error, "Expected character in expression: ", c)
+        ++pos;
+    }
+
+
+    ///@}
+
+}; // Class SymbolicExpression
+
+///@}
+
+///@name Type Definitions
+///@{
+
+
+///@}
+///@name Input and output
+///@{
+
+
+/// output stream function
+inline std::ostream& operator << (std::ostream& rOStream, const SymbolicExpression& rThis)
+{
+    rThis.PrintInfo(rOStream);
+    rOStream << " ";
+    rThis.PrintData(rOStream);
+
+    return rOStream;
+}
+///@}
+
+///@} addtogroup block
+
+}  // namespace Kratos.
+
+#endif // KRATOS_SYMBOLIC_EXPRESSION_H_INCLUDED  defined
@@ -0,0 +1,33 @@
+from array import array
+from KratosMultiphysics import *
+from KratosMultiphysics.BRepApplication import *
+
+def check(name, compiled, expected):
+    points = array('d', [0.5, -1.0, 2.0, 3.0, 0.25, -0.5])
+    values = compiled.GetValues(points)
+    error = 0.0
+    for i in range(0, 2):
+        error = max(error, abs(compiled.GetValue(points[3*i], points[3*i+1], points[3*i+2]) - expected[i]))
+        error = max(error, abs(values[i] - expected[i]))
+    print(name + ": error " + str(error))
+    if error > 1.0e-12:
+        raise Exception("The compiled function returns a wrong value for " + name)
+
+## the sum of the constants is folded to the shared register of 1, which is not always the last register of the tape
+f = CompiledFunctionR3R1(SumFunctionR3R1(ScalarFunctionR3R1(1.0), ScalarFunctionR3R1(0.0)))
+check("1 + 0", f, [1.0, 1.0])
+f = CompiledFunctionR3R1(SumFunctionR3R1(ScalarFunctionR3R1(0.0), ScalarFunctionR3R1(1.0)))
+check("0 + 1", f, [1.0, 1.0])
+
+## scaling by 1 returns the register of the operand
+f = CompiledFunctionR3R1(SumFunctionR3R1(MonomialFunctionR3R1X(), ScaleFunctionR3R1(1.0, MonomialFunctionR3R1X())))
+check("x + 1*x", f, [1.0, 6.0])
+
+## the derivative of x + y is 1 + 0
+f = CompiledFunctionR3R1(SumFunctionR3R1(MonomialFunctionR3R1X(), MonomialFunctionR3R1Y()))
+check("x + y", f, [-0.5, 3.25])
+check("d(x + y)/dx", f.GetDiffFunction(0), [1.0, 1.0])
+check("d(x + y)/dy", f.GetDiffFunction(1), [1.0, 1.0])
+check("d(x + y)/dz", f.GetDiffFunction(2), [0.0, 0.0])
+
+print("The compiled functions are correct")
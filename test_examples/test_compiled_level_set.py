@@ -0,0 +1,64 @@
+import random
+from KratosMultiphysics import *
+from KratosMultiphysics.BRepApplication import *
+
+## tunnel along a spline curve, the distance to the curve has no analytic expression
+t_list = [0.0, 0.5, 1.0]
+x_list = [0.0, 5.0, 10.0]
+y_list = [0.0, 1.0, 0.0]
+z_list = [0.0, 0.0, 0.0]
+
+xt = CubicSplineFunctionR1R1()
+xt.SetLeftBoundary(1, (x_list[1]-x_list[0]) / (t_list[1]-t_list[0]))
+xt.SetRightBoundary(1, (x_list[2]-x_list[1]) / (t_list[2]-t_list[1]))
+xt.SetPoints(t_list, x_list)
+
+yt = CubicSplineFunctionR1R1()
+yt.SetLeftBoundary(1, (y_list[1]-y_list[0]) / (t_list[1]-t_list[0]))
+yt.SetRightBoundary(1, (y_list[2]-y_list[1]) / (t_list[2]-t_list[1]))
+yt.SetPoints(t_list, y_list)
+
+zt = CubicSplineFunctionR1R1()
+zt.SetLeftBoundary(1, (z_list[1]-z_list[0]) / (t_list[1]-t_list[0]))
+zt.SetRightBoundary(1, (z_list[2]-z_list[1]) / (t_list[2]-t_list[1]))
+zt.SetPoints(t_list, z_list)
+
+curve = ParametricCurve(xt, yt, zt)
+curve.SetValue(CURVE_LOWER_BOUND, 0.0)
+curve.SetValue(CURVE_UPPER_BOUND, 1.0)
+curve.SetValue(CURVE_NUMBER_OF_SAMPLING, 20)
+tunnel = DistanceToCurveLevelSet(curve, 1.0)
+
+## unit cube given by a triangle mesh
+vertices = []
+for i in range(0, 8):
+    V = Array3()
+    V[0] = float(i % 2)
+    V[1] = float((i // 2) % 2)
+    V[2] = float(i // 4)
+    vertices.append(V)
+triangles = [[0, 2, 1], [1, 2, 3], [4, 5, 6], [5, 7, 6], [0, 1, 4], [1, 5, 4], \
+             [2, 6, 3], [3, 6, 7], [0, 4, 2], [2, 4, 6], [1, 3, 5], [3, 7, 5]]
+cube = TriangleMeshLevelSet(vertices, triangles)
+
+sphere = SphericalLevelSet(5.0, 0.0, 0.0, 1.0)
+
+## the non-analytic level sets are kept as opaque calls on the tape
+for name, ls in [("tunnel", tunnel), ("cube", cube), ("union", UnionLevelSet(tunnel, cube)), \
+                 ("difference", DifferenceLevelSet(tunnel, sphere)), \
+                 ("n-ary union", NaryUnionLevelSet([tunnel, cube, sphere]))]:
+    compiled = CompiledFunctionR3R1(ls)
+
+    random.seed(0)
+    error = 0.0
+    for i in range(0, 500):
+        P = Array3()
+        P[0] = random.uniform(-2.0, 10.0)
+        P[1] = random.uniform(-2.0, 2.0)
+        P[2] = random.uniform(-2.0, 2.0)
+        error = max(error, abs(compiled.GetValue(P) - ls.GetValue(P)))
+
+    print(name + ": error " + str(error))
+    if error > 1.0e-12:
+        raise Exception("The compiled level set differs from the level set")
+print("The compiled level sets are consistent with the level sets")
@@ -0,0 +1,68 @@
+import math
+import random
+from KratosMultiphysics import *
+from KratosMultiphysics.BRepApplication import *
+
+## composite level sets sharing the same operands
+sphere = SphericalLevelSet(0.0, 0.0, 0.0, 1.0)
+cylinder = CylinderLevelSet(0.0, 0.0, -2.0, 0.0, 0.0, 1.0, 0.5)
+plane = PlanarLevelSet(0.0, 0.0, 1.0, 0.2)
+union = UnionLevelSet(sphere, cylinder)
+intersection = IntersectionLevelSet(union, plane)
+difference = DifferenceLevelSet(intersection, sphere)
+product = ProductLevelSet(InverseLevelSet(sphere), plane)
+
+## tunnel along a spline curve
+t_list = [0.0, 0.5, 1.0]
+x_list = [0.0, 5.0, 10.0]
+y_list = [0.0, 1.0, 0.0]
+z_list = [0.0, 0.0, 0.0]
+
+xt = CubicSplineFunctionR1R1()
+xt.SetLeftBoundary(1, (x_list[1]-x_list[0]) / (t_list[1]-t_list[0]))
+xt.SetRightBoundary(1, (x_list[2]-x_list[1]) / (t_list[2]-t_list[1]))
+xt.SetPoints(t_list, x_list)
+
+yt = CubicSplineFunctionR1R1()
+yt.SetLeftBoundary(1, (y_list[1]-y_list[0]) / (t_list[1]-t_list[0]))
+yt.SetRightBoundary(1, (y_list[2]-y_list[1]) / (t_list[2]-t_list[1]))
+yt.SetPoints(t_list, y_list)
+
+zt = CubicSplineFunctionR1R1()
+zt.SetLeftBoundary(1, (z_list[1]-z_list[0]) / (t_list[1]-t_list[0]))
+zt.SetRightBoundary(1, (z_list[2]-z_list[1]) / (t_list[2]-t_list[1]))
+zt.SetPoints(t_list, z_list)
+
+curve = ParametricCurve(xt, yt, zt)
+curve.SetValue(CURVE_LOWER_BOUND, 0.0)
+curve.SetValue(CURVE_UPPER_BOUND, 1.0)
+curve.SetValue(CURVE_NUMBER_OF_SAMPLING, 20)
+tunnel = DistanceToCurveLevelSet(curve, 1.0)
+
+## composite function, the gradient is computed from the cached derivative functions
+X = MonomialFunctionR3R1X()
+Y = MonomialFunctionR3R1Y()
+function = SumFunctionR3R1(ProductFunctionR3R1(SinFunctionR3R1(X), CosFunctionR3R1(Y)), PowFunctionR3R1(2.0, X))
+
+random.seed(0)
+points = []
+for i in range(0, 2000):
+    P = Array3()
+    P[0] = random.uniform(-2.0, 10.0)
+    P[1] = random.uniform(-2.0, 2.0)
+    P[2] = random.uniform(-2.0, 2.0)
+    points.append(P)
+
+utility = BRepUtility()
+nrepeat = 5
+total = 0
+for name, f, check_gradient in [("union", union, True), ("intersection", intersection, True), \
+                ("difference", difference, True), ("product", product, True), \
+                ("tunnel", tunnel, True), ("function", function, True)]:
+    mismatches = utility.CheckConcurrentEvaluation(f, points, nrepeat, check_gradient)
+    print(name + ": " + str(mismatches) + " mismatches")
+    total = total + mismatches
+
+if total != 0:
+    raise Exception("The concurrent evaluation differs from the serial evaluation")
+print("The concurrent evaluation is consistent with the serial evaluation")